@@ -26,6 +26,11 @@ public class NativeCallbacksWrapperGenerator : ISourceGenerator
 
         var compilation = context.Compilation;
         
+        if (receiver.ClassesWithNativeCallbacks.Count > 0)
+        {
+            GenerateExportedFunctionsTable(context, receiver.ClassesWithNativeCallbacks);
+        }
+        
         foreach (var classInfo in receiver.ClassesWithNativeCallbacks)
         {
             var model = compilation.GetSemanticModel(classInfo.ClassDeclaration.SyntaxTree);
@@ -160,6 +165,72 @@ public class NativeCallbacksWrapperGenerator : ISourceGenerator
             context.AddSource($"{classInfo.Name}.generated.cs", SourceText.From(sourceBuilder.ToString(), Encoding.UTF8));
         }
     }
+
+    // Native code hands over all exported functions in one block, keyed by the id of "ClassName.FieldName".
+    // This generates the switch that assigns each one to its field, so binding needs no reflection or string lookups.
+    private static void GenerateExportedFunctionsTable(GeneratorExecutionContext context, List<ClassInfo> classes)
+    {
+        var sourceBuilder = new StringBuilder();
+        var reportBuilder = new StringBuilder();
+        
+        sourceBuilder.AppendLine("namespace UnrealSharp.Interop");
+        sourceBuilder.AppendLine("{");
+        sourceBuilder.AppendLine("    internal static unsafe class ExportedFunctionsTable");
+        sourceBuilder.AppendLine("    {");
+        sourceBuilder.AppendLine("        public static bool Bind(ulong id, System.IntPtr functionPointer)");
+        sourceBuilder.AppendLine("        {");
+        sourceBuilder.AppendLine("            switch (id)");
+        sourceBuilder.AppendLine("            {");
+
+        foreach (var classInfo in classes)
+        {
+            var model = context.Compilation.GetSemanticModel(classInfo.ClassDeclaration.SyntaxTree);
+            
+            foreach (var delegateInfo in classInfo.Delegates)
+            {
+                string exportedName = $"{classInfo.Name}.{delegateInfo.Name}";
+                string fieldName = $"global::{classInfo.Namespace}.{exportedName}";
+                string fieldType = model.GetTypeInfo(delegateInfo.FieldType).Type.ToDisplayString(SymbolDisplayFormat.FullyQualifiedFormat);
+                
+                sourceBuilder.AppendLine($"                case 0x{GetExportedFunctionId(exportedName):X16}UL: // {exportedName}");
+                sourceBuilder.AppendLine($"                    {fieldName} = ({fieldType}) functionPointer;");
+                sourceBuilder.AppendLine("                    return true;");
+                
+                reportBuilder.AppendLine($"            if ({fieldName} == null)");
+                reportBuilder.AppendLine("            {");
+                reportBuilder.AppendLine($"                System.Console.WriteLine(\"Failed to initialize {exportedName}.\");");
+                reportBuilder.AppendLine("            }");
+            }
+        }
+        
+        sourceBuilder.AppendLine("                default:");
+        sourceBuilder.AppendLine("                    return false;");
+        sourceBuilder.AppendLine("            }");
+        sourceBuilder.AppendLine("        }");
+        sourceBuilder.AppendLine();
+        sourceBuilder.AppendLine("        public static void ReportUnboundFunctions()");
+        sourceBuilder.AppendLine("        {");
+        sourceBuilder.Append(reportBuilder);
+        sourceBuilder.AppendLine("        }");
+        sourceBuilder.AppendLine("    }");
+        sourceBuilder.AppendLine("}");
+        
+        context.AddSource("ExportedFunctionsTable.generated.cs", SourceText.From(sourceBuilder.ToString(), Encoding.UTF8));
+    }
+
+    // 64-bit FNV-1a, must match CSExportedFunctionId::Hash in FunctionsExporter.h
+    private static ulong GetExportedFunctionId(string exportedName)
+    {
+        unchecked
+        {
+            ulong hash = 0xcbf29ce484222325;
+            foreach (char character in exportedName)
+            {
+                hash = (hash ^ (byte) character) * 0x100000001b3;
+            }
+            return hash;
+        }
+    }
 }
 
 internal class NativeCallbacksSyntaxReceiver : ISyntaxReceiver
@@ -223,6 +294,7 @@ internal class NativeCallbacksSyntaxReceiver : ISyntaxReceiver
             var delegateInfo = new DelegateInfo
             {
                 Name = fieldDeclaration.Declaration.Variables.First().Identifier.ValueText,
+                FieldType = functionPointerTypeSyntax,
                 Parameters = new List<DelegateParameterInfo>()
             };
 
@@ -258,6 +330,7 @@ internal struct ClassInfo
 internal struct DelegateInfo
 {
     public string Name { get; set; }
+    public TypeSyntax FieldType { get; set; }
     public List<DelegateParameterInfo> Parameters { get; set; }
 }
 
@@ -0,0 +1,90 @@
+using UnrealSharp.CoreUObject;
+using UnrealSharp.Tests.Fakes;
+using Xunit;
+using Xunit.Abstractions;
+
+namespace UnrealSharp.Tests;
+
+// Fills and reads back a 100k element array one element at a time, and with the range operations.
+// The native side is faked, so the numbers are the cost of the managed side and the number of transitions.
+public class ArrayBenchmarks
+{
+    private const int NumElements = 100_000;
+    
+    private readonly ITestOutputHelper _output;
+
+    public ArrayBenchmarks(ITestOutputHelper output)
+    {
+        _output = output;
+        FakeArrayProperty.Install();
+    }
+
+    [Fact]
+    public void IntArray()
+    {
+        RunBenchmark(i => i, BlittableMarshaller<int>.ToNative, BlittableMarshaller<int>.FromNative);
+    }
+
+    [Fact]
+    public void VectorArray()
+    {
+        RunBenchmark(i => new Vector(i, i, i), BlittableMarshaller<Vector>.ToNative, BlittableMarshaller<Vector>.FromNative);
+    }
+
+    [Fact]
+    public void StringArray()
+    {
+        RunBenchmark(i => $"Element{i}", StringMarshaller.ToNative, StringMarshaller.FromNative);
+    }
+
+    private void RunBenchmark<T>(Func<int, T> makeElement, MarshallingDelegates<T>.ToNative toNative, MarshallingDelegates<T>.FromNative fromNative)
+    {
+        T[] elements = Enumerable.Range(0, NumElements).Select(makeElement).ToArray();
+        T[] copiedElements = new T[NumElements];
+        
+        IntPtr property = FakeArrayProperty.CreateProperty<T>();
+        IntPtr nativeArray = FakeArrayProperty.CreateArray();
+        Array<T> array = new Array<T>(property, nativeArray, toNative, fromNative);
+
+        try
+        {
+            string name = typeof(T).Name;
+            
+            Benchmark.Report(_output, $"{name} Add", Benchmark.Measure(NumElements, () =>
+            {
+                array.Clear();
+                
+                foreach (T element in elements)
+                {
+                    array.Add(element);
+                }
+            }));
+            
+            Benchmark.Report(_output, $"{name} AddRange", Benchmark.Measure(NumElements, () =>
+            {
+                array.Clear();
+                array.AddRange(elements);
+            }));
+            
+            Benchmark.Report(_output, $"{name} Get", Benchmark.Measure(NumElements, () =>
+            {
+                for (int i = 0; i < NumElements; ++i)
+                {
+                    copiedElements[i] = array.Get(i);
+                }
+            }));
+            
+            Benchmark.Report(_output, $"{name} CopyTo", Benchmark.Measure(NumElements, () => array.CopyTo(copiedElements)));
+            
+            Assert.Equal(elements, copiedElements);
+
+            int numArrayCalls = FakeArrayProperty.NumArrayCalls;
+            array.AddRange(elements);
+            Assert.Equal(numArrayCalls + 1, FakeArrayProperty.NumArrayCalls);
+        }
+        finally
+        {
+            FakeArrayProperty.DestroyArray(property, nativeArray);
+        }
+    }
+}
@@ -0,0 +1,4 @@
+using Xunit;
+
+// The fakes replace the exported native functions, which are static, so tests can't run side by side.
+[assembly: CollectionBehavior(DisableTestParallelization = true)]
@@ -0,0 +1,34 @@
+using System.Diagnostics;
+using Xunit.Abstractions;
+
+namespace UnrealSharp.Tests;
+
+public readonly record struct BenchmarkResult(double NanosecondsPerOperation, double BytesPerOperation);
+
+/// <summary>
+/// Times a batch of operations and counts the managed memory it allocates. The benchmarks write their numbers to the test output,
+/// and only assert on what doesn't depend on the machine, like the number of native calls.
+/// </summary>
+public static class Benchmark
+{
+    public static BenchmarkResult Measure(int numOperations, Action runOperations)
+    {
+        // Once to warm up, so JIT compilation and caches filled on first use aren't measured.
+        runOperations();
+
+        long allocatedBytes = GC.GetAllocatedBytesForCurrentThread();
+        long startTimestamp = Stopwatch.GetTimestamp();
+        
+        runOperations();
+        
+        TimeSpan elapsedTime = Stopwatch.GetElapsedTime(startTimestamp);
+        allocatedBytes = GC.GetAllocatedBytesForCurrentThread() - allocatedBytes;
+
+        return new BenchmarkResult(elapsedTime.TotalNanoseconds / numOperations, (double) allocatedBytes / numOperations);
+    }
+
+    public static void Report(ITestOutputHelper output, string name, BenchmarkResult result)
+    {
+        output.WriteLine($"{name}: {result.NanosecondsPerOperation:F1} ns, {result.BytesPerOperation:F1} bytes allocated per operation");
+    }
+}
@@ -0,0 +1,144 @@
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using UnrealSharp.Interop;
+
+namespace UnrealSharp.Tests.Fakes;
+
+/// <summary>
+/// Stands in for the native array functions behind FArrayPropertyExporter and FStringExporter, and counts the calls made into them.
+/// A fake property is only an index into a list of element layouts.
+/// </summary>
+public static unsafe class FakeArrayProperty
+{
+    private readonly record struct ElementLayout(int Size, bool IsString);
+
+    private static readonly List<ElementLayout> Properties = [];
+
+    public static int NumArrayCalls;
+    public static int NumStringCalls;
+
+    public static void Install()
+    {
+        FArrayPropertyExporter.InitializeArray = &InitializeArray;
+        FArrayPropertyExporter.EmptyArray = &EmptyArray;
+        FArrayPropertyExporter.AddToArray = &AddToArray;
+        FArrayPropertyExporter.AddRangeToArray = &AddRangeToArray;
+        FArrayPropertyExporter.ReserveArray = &ReserveArray;
+        FArrayPropertyExporter.ResizeArray = &ResizeArray;
+        FStringExporter.MarshalToNativeString = &MarshalToNativeString;
+    }
+
+    public static IntPtr CreateProperty<T>()
+    {
+        bool isString = typeof(T) == typeof(string);
+        Properties.Add(new ElementLayout(isString ? sizeof(UnmanagedArray) : Unsafe.SizeOf<T>(), isString));
+        return Properties.Count;
+    }
+
+    public static IntPtr CreateArray()
+    {
+        return (IntPtr) NativeMemory.AllocZeroed((nuint) sizeof(UnmanagedArray));
+    }
+
+    public static void DestroyArray(IntPtr property, IntPtr array)
+    {
+        Resize(property, (UnmanagedArray*) array, 0);
+        NativeMemory.Free((void*) ((UnmanagedArray*) array)->Data);
+        NativeMemory.Free((void*) array);
+    }
+
+    private static void Resize(IntPtr property, UnmanagedArray* array, int length)
+    {
+        ElementLayout layout = Properties[(int) property - 1];
+        
+        if (layout.IsString)
+        {
+            for (int i = length; i < array->ArrayNum; ++i)
+            {
+                NativeMemory.Free((void*) ((UnmanagedArray*) array->Data)[i].Data);
+            }
+        }
+
+        Reserve(property, array, length);
+        
+        if (length > array->ArrayNum)
+        {
+            NativeMemory.Clear((byte*) array->Data + array->ArrayNum * layout.Size, (nuint) ((length - array->ArrayNum) * layout.Size));
+        }
+        
+        array->ArrayNum = length;
+    }
+
+    private static void Reserve(IntPtr property, UnmanagedArray* array, int capacity)
+    {
+        if (capacity <= array->ArrayMax)
+        {
+            return;
+        }
+
+        // Grows like TArray, so adding one element at a time isn't quadratic.
+        int newCapacity = Math.Max(capacity, array->ArrayMax * 2);
+        array->Data = (IntPtr) NativeMemory.Realloc((void*) array->Data, (nuint) (newCapacity * Properties[(int) property - 1].Size));
+        array->ArrayMax = newCapacity;
+    }
+
+    [UnmanagedCallersOnly]
+    private static void InitializeArray(IntPtr property, IntPtr array, int length)
+    {
+        NumArrayCalls++;
+        Resize(property, (UnmanagedArray*) array, 0);
+        Resize(property, (UnmanagedArray*) array, length);
+    }
+
+    [UnmanagedCallersOnly]
+    private static void EmptyArray(IntPtr property, IntPtr array)
+    {
+        NumArrayCalls++;
+        Resize(property, (UnmanagedArray*) array, 0);
+    }
+
+    [UnmanagedCallersOnly]
+    private static void AddToArray(IntPtr property, IntPtr array)
+    {
+        NumArrayCalls++;
+        Resize(property, (UnmanagedArray*) array, ((UnmanagedArray*) array)->ArrayNum + 1);
+    }
+
+    [UnmanagedCallersOnly]
+    private static int AddRangeToArray(IntPtr property, IntPtr array, int count)
+    {
+        NumArrayCalls++;
+        int startIndex = ((UnmanagedArray*) array)->ArrayNum;
+        Resize(property, (UnmanagedArray*) array, startIndex + count);
+        return startIndex;
+    }
+
+    [UnmanagedCallersOnly]
+    private static void ReserveArray(IntPtr property, IntPtr array, int capacity)
+    {
+        NumArrayCalls++;
+        Reserve(property, (UnmanagedArray*) array, capacity);
+    }
+
+    [UnmanagedCallersOnly]
+    private static void ResizeArray(IntPtr property, IntPtr array, int length)
+    {
+        NumArrayCalls++;
+        Resize(property, (UnmanagedArray*) array, length);
+    }
+
+    [UnmanagedCallersOnly]
+    private static void MarshalToNativeString(IntPtr nativeString, char* value, int length)
+    {
+        NumStringCalls++;
+        UnmanagedArray* ustring = (UnmanagedArray*) nativeString;
+        
+        char* data = (char*) NativeMemory.Realloc((void*) ustring->Data, (nuint) ((length + 1) * sizeof(char)));
+        new ReadOnlySpan<char>(value, length).CopyTo(new Span<char>(data, length));
+        data[length] = '\0';
+        
+        ustring->Data = (IntPtr) data;
+        ustring->ArrayNum = length + 1;
+        ustring->ArrayMax = length + 1;
+    }
+}
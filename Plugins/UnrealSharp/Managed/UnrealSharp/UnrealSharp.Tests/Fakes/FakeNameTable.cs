@@ -0,0 +1,121 @@
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using UnrealSharp.Interop;
+
+namespace UnrealSharp.Tests.Fakes;
+
+/// <summary>
+/// Stands in for the native name table behind FNameExporter, and counts the calls made into it.
+/// </summary>
+public static unsafe class FakeNameTable
+{
+    // Same layout as Name and FName.
+    private struct FakeName
+    {
+        public int ComparisonIndex;
+        public int DisplayIndex;
+        public int Number;
+    }
+    
+    private static readonly List<string> Entries = ["None"];
+    private static readonly Dictionary<string, int> DisplayEntries = new(StringComparer.Ordinal) { ["None"] = 0 };
+    private static readonly Dictionary<string, int> ComparisonEntries = new(StringComparer.OrdinalIgnoreCase) { ["None"] = 0 };
+
+    public static int NumStringToName;
+    public static int NumNameToString;
+    public static int NumIsValid;
+
+    public static void Install()
+    {
+        FNameExporter.StringToName = (delegate* unmanaged<ref Name, IntPtr, void>) (delegate* unmanaged<FakeName*, char*, void>) &StringToName;
+        FNameExporter.StringsToNames = (delegate* unmanaged<IntPtr, IntPtr, int, void>) (delegate* unmanaged<FakeName*, char*, int, void>) &StringsToNames;
+        FNameExporter.NameToString = (delegate* unmanaged<Name, ref UnmanagedArray, void>) (delegate* unmanaged<FakeName, UnmanagedArray*, void>) &NameToString;
+        FNameExporter.IsValid = (delegate* unmanaged<Name, bool>) (delegate* unmanaged<FakeName, int>) &IsValid;
+        FScriptArrayExporter.Destroy = (delegate* unmanaged<ref UnmanagedArray, void>) (delegate* unmanaged<UnmanagedArray*, void>) &Destroy;
+    }
+
+    /// <summary>
+    /// Builds a name that points past the end of the name table, like uninitialized memory would.
+    /// </summary>
+    public static Name MakeInvalidName()
+    {
+        FakeName invalidName = new() { ComparisonIndex = int.MaxValue, DisplayIndex = int.MaxValue };
+        return Unsafe.As<FakeName, Name>(ref invalidName);
+    }
+
+    private static FakeName FindOrAdd(string value)
+    {
+        // Like FName, a trailing _<number> is stored as the number plus one, so 0 can mean no number.
+        int number = 0;
+        int separator = value.LastIndexOf('_');
+        
+        if (separator > 0 && int.TryParse(value.AsSpan(separator + 1), out int parsedNumber) && parsedNumber >= 0 && value[separator + 1] != '0')
+        {
+            number = parsedNumber + 1;
+            value = value.Substring(0, separator);
+        }
+
+        if (!DisplayEntries.TryGetValue(value, out int displayIndex))
+        {
+            displayIndex = Entries.Count;
+            Entries.Add(value);
+            DisplayEntries.Add(value, displayIndex);
+        }
+
+        if (!ComparisonEntries.TryGetValue(value, out int comparisonIndex))
+        {
+            comparisonIndex = displayIndex;
+            ComparisonEntries.Add(value, comparisonIndex);
+        }
+
+        return new FakeName { ComparisonIndex = comparisonIndex, DisplayIndex = displayIndex, Number = number };
+    }
+
+    [UnmanagedCallersOnly]
+    private static void StringToName(FakeName* outName, char* value)
+    {
+        NumStringToName++;
+        *outName = value == null ? default : FindOrAdd(new string(value));
+    }
+
+    [UnmanagedCallersOnly]
+    private static void StringsToNames(FakeName* outNames, char* values, int count)
+    {
+        NumStringToName++;
+        
+        for (int i = 0; i < count; ++i)
+        {
+            string value = new string(values);
+            outNames[i] = FindOrAdd(value);
+            values += value.Length + 1;
+        }
+    }
+
+    [UnmanagedCallersOnly]
+    private static void NameToString(FakeName name, UnmanagedArray* outString)
+    {
+        NumNameToString++;
+        
+        string value = name.Number == 0 ? Entries[name.DisplayIndex] : $"{Entries[name.DisplayIndex]}_{name.Number - 1}";
+        char* data = (char*) NativeMemory.Alloc((nuint) (value.Length + 1), sizeof(char));
+        value.AsSpan().CopyTo(new Span<char>(data, value.Length));
+        data[value.Length] = '\0';
+        
+        outString->Data = (IntPtr) data;
+        outString->ArrayNum = value.Length + 1;
+        outString->ArrayMax = value.Length + 1;
+    }
+
+    [UnmanagedCallersOnly]
+    private static int IsValid(FakeName name)
+    {
+        NumIsValid++;
+        return name.ComparisonIndex >= 0 && name.ComparisonIndex < Entries.Count ? 1 : 0;
+    }
+
+    [UnmanagedCallersOnly]
+    private static void Destroy(UnmanagedArray* array)
+    {
+        NativeMemory.Free((void*) array->Data);
+    }
+}
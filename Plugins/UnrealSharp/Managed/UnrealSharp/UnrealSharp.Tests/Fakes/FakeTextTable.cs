@@ -0,0 +1,55 @@
+using System.Runtime.InteropServices;
+using UnrealSharp.Interop;
+
+namespace UnrealSharp.Tests.Fakes;
+
+/// <summary>
+/// Stands in for the native FText data behind FTextExporter, and counts the calls made into it.
+/// </summary>
+public static unsafe class FakeTextTable
+{
+    private struct FakeTextData
+    {
+        public char* DisplayString;
+        public int Length;
+    }
+    
+    public static int NumToString;
+
+    public static void Install()
+    {
+        FTextExporter.ToString = (delegate* unmanaged<ref TextData, out int, char*>) (delegate* unmanaged<TextData*, int*, char*>) &ToString;
+        FTextExporter.FromString = (delegate* unmanaged<ref TextData, char*, int, void>) (delegate* unmanaged<TextData*, char*, int, void>) &FromString;
+    }
+
+    /// <summary>
+    /// Replaces the display string of the native text, like a culture change would.
+    /// </summary>
+    public static void SetDisplayString(TextData text, string value)
+    {
+        FakeTextData* data = (FakeTextData*) text.ObjectPointer;
+        NativeMemory.Free(data->DisplayString);
+        
+        data->DisplayString = (char*) NativeMemory.Alloc((nuint) Math.Max(value.Length, 1), sizeof(char));
+        data->Length = value.Length;
+        value.AsSpan().CopyTo(new Span<char>(data->DisplayString, value.Length));
+    }
+
+    [UnmanagedCallersOnly]
+    private static char* ToString(TextData* text, int* outLength)
+    {
+        NumToString++;
+        
+        FakeTextData* data = (FakeTextData*) text->ObjectPointer;
+        *outLength = data->Length;
+        return data->DisplayString;
+    }
+
+    [UnmanagedCallersOnly]
+    private static void FromString(TextData* text, char* value, int length)
+    {
+        FakeTextData* data = (FakeTextData*) NativeMemory.AllocZeroed((nuint) sizeof(FakeTextData));
+        *text = new TextData { ObjectPointer = (IntPtr) data, SharedReferenceCount = 1 };
+        SetDisplayString(*text, new string(value, 0, length));
+    }
+}
@@ -0,0 +1,72 @@
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+using UnrealSharp.Interop;
+using Xunit;
+
+namespace UnrealSharp.Tests;
+
+public unsafe class ManagedHandleTests
+{
+    private class TestObject : UnrealSharpObject
+    {
+        public int NumDisposed;
+        public IntPtr NativeObjectWhenDisposed;
+
+        // Overrides don't have to call the base, the wrapper is cleared anyway.
+        public override void Dispose()
+        {
+            NumDisposed++;
+            NativeObjectWhenDisposed = NativeObject;
+        }
+    }
+
+    // Stands in for the address of a native UObject, it's never dereferenced.
+    private static readonly IntPtr FakeNativeObject = 0x1000;
+
+    [Fact]
+    public void DisposingHandlesClearsWrappersInOneCall()
+    {
+        const int numObjects = 3;
+        IntPtr* handles = stackalloc IntPtr[numObjects];
+        TestObject[] testObjects = new TestObject[numObjects];
+
+        for (int i = 0; i < numObjects; i++)
+        {
+            handles[i] = UnrealSharpObject.Create(typeof(TestObject), FakeNativeObject, false);
+            testObjects[i] = (TestObject) GCHandle.FromIntPtr(handles[i]).Target!;
+        }
+
+        delegate* unmanaged<IntPtr*, int, void> disposeHandles = &UnmanagedCallbacks.DisposeHandles;
+        disposeHandles(handles, numObjects);
+
+        foreach (TestObject testObject in testObjects)
+        {
+            // Cleared before Dispose runs, so IsDestroyed answers without passing the deleted object to native code.
+            Assert.Equal(IntPtr.Zero, testObject.NativeObjectWhenDisposed);
+            Assert.Equal(IntPtr.Zero, testObject.NativeObject);
+            Assert.True(testObject.IsDestroyed);
+            Assert.Equal(1, testObject.NumDisposed);
+        }
+    }
+
+    [Fact]
+    public void CollectedWeakHandleIsNullInItsSlot()
+    {
+        // Native code checks weak handles by reading the slot they point at, instead of calling into C#.
+        IntPtr handle = CreateUnreferencedWeakObject();
+        Assert.NotEqual(IntPtr.Zero, *(IntPtr*) handle);
+
+        GC.Collect();
+        GC.WaitForPendingFinalizers();
+        GC.Collect();
+        
+        Assert.Equal(IntPtr.Zero, *(IntPtr*) handle);
+        GCHandle.FromIntPtr(handle).Free();
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static IntPtr CreateUnreferencedWeakObject()
+    {
+        return UnrealSharpObject.Create(typeof(TestObject), FakeNativeObject, true);
+    }
+}
@@ -0,0 +1,123 @@
+using UnrealSharp.Interop;
+using UnrealSharp.Tests.Fakes;
+using Xunit;
+using Xunit.Abstractions;
+
+namespace UnrealSharp.Tests;
+
+// Compares the cached name conversions with calling the name exporter every time, as Name did before it had a cache.
+// The native name table is faked, so the uncached numbers only include the cost of the transition, not of the real table.
+public unsafe class NameBenchmarks
+{
+    private const int NumNames = 1000;
+    private const int NumConversions = 100_000;
+    
+    private readonly ITestOutputHelper _output;
+
+    public NameBenchmarks(ITestOutputHelper output)
+    {
+        _output = output;
+        FakeNameTable.Install();
+    }
+
+    private static string[] MakeStrings(string prefix)
+    {
+        return Enumerable.Range(0, NumNames).Select(i => $"{prefix}{i}").ToArray();
+    }
+
+    [Fact]
+    public void StringToName()
+    {
+        string[] strings = MakeStrings("BenchmarkStringToName");
+        Name[] names = new Name[NumNames];
+        
+        // The string cache starts over when it's full, which can happen while the names are first added.
+        // Adding them up front leaves the warm-up run to add back any that were dropped, so the measured run only hits the cache.
+        Name.FromStrings(strings, names);
+        
+        BenchmarkResult uncached = Benchmark.Measure(NumConversions, () =>
+        {
+            for (int i = 0; i < NumConversions; ++i)
+            {
+                fixed (char* stringPtr = strings[i % NumNames])
+                {
+                    FNameExporter.CallStringToName(ref names[i % NumNames], (IntPtr) stringPtr);
+                }
+            }
+        });
+        
+        BenchmarkResult cached = Benchmark.Measure(NumConversions, () =>
+        {
+            for (int i = 0; i < NumConversions; ++i)
+            {
+                names[i % NumNames] = new Name(strings[i % NumNames]);
+            }
+        });
+        
+        Benchmark.Report(_output, "Name(string) through the exporter", uncached);
+        Benchmark.Report(_output, "Name(string) cached", cached);
+        Assert.Equal(0.0, cached.BytesPerOperation);
+    }
+
+    [Fact]
+    public void NameToString()
+    {
+        Name[] names = MakeStrings("BenchmarkNameToString").Select(value => new Name(value)).ToArray();
+        string[] strings = new string[NumNames];
+        
+        BenchmarkResult uncached = Benchmark.Measure(NumConversions, () =>
+        {
+            for (int i = 0; i < NumConversions; ++i)
+            {
+                UnmanagedArray buffer = new UnmanagedArray();
+                FNameExporter.CallNameToString(names[i % NumNames], ref buffer);
+                strings[i % NumNames] = new string((char*) buffer.Data);
+                buffer.Destroy();
+            }
+        });
+        
+        BenchmarkResult cached = Benchmark.Measure(NumConversions, () =>
+        {
+            for (int i = 0; i < NumConversions; ++i)
+            {
+                strings[i % NumNames] = names[i % NumNames].ToString();
+            }
+        });
+        
+        Benchmark.Report(_output, "Name.ToString through the exporter", uncached);
+        Benchmark.Report(_output, "Name.ToString cached", cached);
+        Assert.Equal(0.0, cached.BytesPerOperation);
+    }
+
+    [Fact]
+    public void StringsToNames()
+    {
+        // Each measured run resolves strings that aren't cached yet, the warm-up run included.
+        string[][] oneByOneBatches = [MakeStrings("BenchmarkOneByOneWarmup"), MakeStrings("BenchmarkOneByOne")];
+        string[][] bulkBatches = [MakeStrings("BenchmarkBulkWarmup"), MakeStrings("BenchmarkBulk")];
+        Name[] names = new Name[NumNames];
+        int oneByOneRun = 0;
+        int bulkRun = 0;
+
+        int numStringToName = FakeNameTable.NumStringToName;
+        BenchmarkResult oneByOne = Benchmark.Measure(NumNames, () =>
+        {
+            string[] strings = oneByOneBatches[oneByOneRun++];
+            
+            for (int i = 0; i < NumNames; ++i)
+            {
+                names[i] = new Name(strings[i]);
+            }
+        });
+        int numOneByOneCalls = FakeNameTable.NumStringToName - numStringToName;
+
+        numStringToName = FakeNameTable.NumStringToName;
+        BenchmarkResult bulk = Benchmark.Measure(NumNames, () => Name.FromStrings(bulkBatches[bulkRun++], names));
+        int numBulkCalls = FakeNameTable.NumStringToName - numStringToName;
+        
+        Benchmark.Report(_output, $"{NumNames} new names one by one", oneByOne);
+        Benchmark.Report(_output, $"{NumNames} new names with Name.FromStrings", bulk);
+        Assert.Equal(2 * NumNames, numOneByOneCalls);
+        Assert.Equal(2, numBulkCalls);
+    }
+}
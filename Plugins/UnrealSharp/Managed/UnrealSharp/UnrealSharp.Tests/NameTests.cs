@@ -0,0 +1,84 @@
+using UnrealSharp.Tests.Fakes;
+using Xunit;
+
+namespace UnrealSharp.Tests;
+
+// Names are cached for the whole process, so every test uses strings no other test converts.
+public class NameTests
+{
+    public NameTests()
+    {
+        FakeNameTable.Install();
+    }
+    
+    [Fact]
+    public void NullAndEmptyStringsAreNone()
+    {
+        string? nullString = null;
+        
+        Assert.Equal(Name.None, new Name(nullString));
+        Assert.Equal(Name.None, (Name) nullString);
+        Assert.Equal(Name.None, new Name(string.Empty));
+
+        Span<Name> names = stackalloc Name[2];
+        Name.FromStrings([nullString!, string.Empty], names);
+        
+        Assert.Equal(Name.None, names[0]);
+        Assert.Equal(Name.None, names[1]);
+    }
+
+    [Fact]
+    public void ConvertingToStringOnlyCallsNativeOnce()
+    {
+        Name name = new Name("ConvertedOnce");
+        int numIsValid = FakeNameTable.NumIsValid;
+        int numNameToString = FakeNameTable.NumNameToString;
+
+        for (int i = 0; i < 3; ++i)
+        {
+            string value = name;
+            Assert.Equal("ConvertedOnce", value);
+        }
+
+        Assert.Equal(numIsValid + 1, FakeNameTable.NumIsValid);
+        Assert.Equal(numNameToString + 1, FakeNameTable.NumNameToString);
+    }
+
+    [Fact]
+    public void NumberedNamesShareTheirBaseString()
+    {
+        Name first = new Name("Socket_3");
+        Name second = new Name("Socket_12");
+        int numNameToString = FakeNameTable.NumNameToString;
+
+        Assert.Equal("Socket_3", first.ToString());
+        Assert.Equal("Socket_12", second.ToString());
+        Assert.Equal(numNameToString + 1, FakeNameTable.NumNameToString);
+    }
+
+    [Fact]
+    public void InvalidNamesConvertToNone()
+    {
+        Assert.Equal(Name.None.ToString(), (string) FakeNameTable.MakeInvalidName());
+    }
+
+    [Fact]
+    public void StringCacheIsBounded()
+    {
+        Name first = new Name("Bounded_First");
+        int numStringToName = FakeNameTable.NumStringToName;
+        
+        Assert.Equal(first, new Name("Bounded_First"));
+        Assert.Equal(numStringToName, FakeNameTable.NumStringToName);
+
+        // Enough distinct strings to fill the cache, after which it starts over.
+        for (int i = 0; i < 20000; ++i)
+        {
+            _ = new Name($"Bounded_Filler{i}");
+        }
+
+        numStringToName = FakeNameTable.NumStringToName;
+        Assert.Equal(first, new Name("Bounded_First"));
+        Assert.Equal(numStringToName + 1, FakeNameTable.NumStringToName);
+    }
+}
@@ -0,0 +1,99 @@
+using System.Runtime.InteropServices;
+using UnrealSharp.Interop;
+using UnrealSharp.Tests.Fakes;
+using Xunit;
+using Xunit.Abstractions;
+
+namespace UnrealSharp.Tests;
+
+// Reads and writes a hot FString property the way generated getters and setters do, compared with how strings were marshalled
+// before they were read through the string pool and written in place.
+public unsafe class StringBenchmarks : IDisposable
+{
+    private const int NumValues = 16;
+    private const int NumAccesses = 100_000;
+    
+    private readonly ITestOutputHelper _output;
+    private readonly string[] _values = Enumerable.Range(0, NumValues).Select(i => $"BenchmarkValue{i:D2}").ToArray();
+    private readonly UnmanagedArray* _nativeStrings = (UnmanagedArray*) NativeMemory.AllocZeroed(NumValues, (nuint) sizeof(UnmanagedArray));
+
+    public StringBenchmarks(ITestOutputHelper output)
+    {
+        _output = output;
+        
+        // The array fake also stands in for the string exporter, and the name table fake for freeing native strings.
+        FakeArrayProperty.Install();
+        FakeNameTable.Install();
+        
+        for (int i = 0; i < NumValues; ++i)
+        {
+            StringMarshaller.ToNative((IntPtr) _nativeStrings, i, _values[i]);
+        }
+    }
+
+    public void Dispose()
+    {
+        for (int i = 0; i < NumValues; ++i)
+        {
+            StringMarshaller.DestructInstance((IntPtr) _nativeStrings, i);
+        }
+        
+        NativeMemory.Free(_nativeStrings);
+    }
+
+    [Fact]
+    public void ReadingHotStrings()
+    {
+        string[] readValues = new string[NumValues];
+        
+        BenchmarkResult copied = Benchmark.Measure(NumAccesses, () =>
+        {
+            for (int i = 0; i < NumAccesses; ++i)
+            {
+                readValues[i % NumValues] = new string((char*) _nativeStrings[i % NumValues].Data);
+            }
+        });
+        
+        BenchmarkResult pooled = Benchmark.Measure(NumAccesses, () =>
+        {
+            for (int i = 0; i < NumAccesses; ++i)
+            {
+                readValues[i % NumValues] = StringMarshaller.FromNative((IntPtr) _nativeStrings, i % NumValues);
+            }
+        });
+        
+        Benchmark.Report(_output, "Read as a new string", copied);
+        Benchmark.Report(_output, "Read through the string pool", pooled);
+        Assert.Equal(_values, readValues);
+        Assert.Equal(0.0, pooled.BytesPerOperation);
+    }
+
+    [Fact]
+    public void WritingStringsOfTheSameLength()
+    {
+        BenchmarkResult native = Benchmark.Measure(NumAccesses, () =>
+        {
+            for (int i = 0; i < NumAccesses; ++i)
+            {
+                fixed (char* valuePtr = _values[i % NumValues])
+                {
+                    FStringExporter.CallMarshalToNativeString((IntPtr) _nativeStrings, valuePtr, _values[i % NumValues].Length);
+                }
+            }
+        });
+
+        int numStringCalls = FakeArrayProperty.NumStringCalls;
+        BenchmarkResult inPlace = Benchmark.Measure(NumAccesses, () =>
+        {
+            for (int i = 0; i < NumAccesses; ++i)
+            {
+                StringMarshaller.ToNative((IntPtr) _nativeStrings, 0, _values[i % NumValues]);
+            }
+        });
+        
+        Benchmark.Report(_output, "Written by native code", native);
+        Benchmark.Report(_output, "Written in place", inPlace);
+        Assert.Equal(numStringCalls, FakeArrayProperty.NumStringCalls);
+        Assert.Equal(0.0, inPlace.BytesPerOperation);
+    }
+}
@@ -0,0 +1,68 @@
+using UnrealSharp.Tests.Fakes;
+using Xunit;
+
+namespace UnrealSharp.Tests;
+
+public unsafe class TextTests
+{
+    public TextTests()
+    {
+        FakeTextTable.Install();
+    }
+
+    // Copies the text into native memory the way a property setter does.
+    private static TextData ToNative(Text text)
+    {
+        TextData data;
+        TextMarshaller.ToNative((IntPtr) (&data), 0, text);
+        return data;
+    }
+
+    // Reads the text back the way a property getter does, which wraps it in a new Text every time.
+    private static Text FromNative(TextData data)
+    {
+        return TextMarshaller.FromNative((IntPtr) (&data), 0);
+    }
+
+    [Fact]
+    public void ReadingTextOnlyCallsNativeOnce()
+    {
+        Text text = new Text("Read once");
+        int numToString = FakeTextTable.NumToString;
+        
+        Assert.Equal("Read once", text.ToString());
+        Assert.Equal(numToString + 1, FakeTextTable.NumToString);
+    }
+
+    [Fact]
+    public void RereadingTheSameNativeTextReusesTheString()
+    {
+        TextData data = ToNative(new Text("Marshalled per read"));
+
+        string first = FromNative(data).ToString();
+        string second = FromNative(data).ToString();
+        
+        Assert.Equal("Marshalled per read", first);
+        Assert.Same(first, second);
+    }
+
+    [Fact]
+    public void ChangedDisplayStringIsNotCached()
+    {
+        TextData data = ToNative(new Text("Before"));
+        Assert.Equal("Before", FromNative(data).ToString());
+        
+        FakeTextTable.SetDisplayString(data, "After");
+        
+        Assert.Equal("After", FromNative(data).ToString());
+    }
+
+    [Fact]
+    public void LongTextIsReadInFull()
+    {
+        string value = new string('x', 1000);
+        Text text = new Text(value);
+        
+        Assert.Equal(value, text.ToString());
+    }
+}
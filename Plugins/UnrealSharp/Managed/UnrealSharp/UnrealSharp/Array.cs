@@ -50,6 +50,90 @@ public class Array<T> : UnrealArrayBase<T>, IList<T>
         this[newIndex] = item;
     }
 
+    /// <summary>
+    /// Adds a range of elements to the end of the array with a single native call.
+    /// Blittable elements are copied as one block of memory.
+    /// </summary>
+    /// <param name="items"> The elements to add. </param>
+    public void AddRange(ReadOnlySpan<T> items)
+    {
+        if (items.IsEmpty)
+        {
+            return;
+        }
+        
+        int startIndex = FArrayPropertyExporter.CallAddRangeToArray(NativeUnrealProperty, NativeBuffer, items.Length);
+        
+        if (IsBlittable)
+        {
+            items.CopyTo(GetNativeSpan().Slice(startIndex));
+            return;
+        }
+        
+        IntPtr arrayBuffer = NativeArrayBuffer;
+        for (int i = 0; i < items.Length; ++i)
+        {
+            ToNative(arrayBuffer, startIndex + i, items[i]);
+        }
+    }
+    
+    /// <summary>
+    /// Removes a range of elements from the array with a single native call.
+    /// </summary>
+    /// <param name="index"> The index of the first element to remove. </param>
+    /// <param name="count"> The number of elements to remove. </param>
+    public void RemoveRange(int index, int count)
+    {
+        if (index < 0 || count < 0 || index + count > Count)
+        {
+            throw new IndexOutOfRangeException($"Range {index}..{index + count} is out of bounds. Array size is {Count}.");
+        }
+        
+        FArrayPropertyExporter.CallRemoveRangeFromArray(NativeUnrealProperty, NativeBuffer, index, count);
+    }
+    
+    /// <summary>
+    /// Makes sure the array can hold the specified number of elements without reallocating.
+    /// </summary>
+    /// <param name="capacity"> The number of elements to reserve memory for. </param>
+    public void Reserve(int capacity)
+    {
+        FArrayPropertyExporter.CallReserveArray(NativeUnrealProperty, NativeBuffer, capacity);
+    }
+    
+    /// <summary>
+    /// Replaces the contents of the array with the specified elements.
+    /// Blittable elements are copied as one block of memory.
+    /// </summary>
+    /// <param name="items"> The elements to copy into the array. </param>
+    public void CopyFrom(ReadOnlySpan<T> items)
+    {
+        FArrayPropertyExporter.CallInitializeArray(NativeUnrealProperty, NativeBuffer, items.Length);
+        
+        if (IsBlittable)
+        {
+            items.CopyTo(GetNativeSpan());
+            return;
+        }
+        
+        IntPtr arrayBuffer = NativeArrayBuffer;
+        for (int i = 0; i < items.Length; ++i)
+        {
+            ToNative(arrayBuffer, i, items[i]);
+        }
+    }
+    
+    /// <summary>
+    /// Gets a view over the native array data that can be read and written without marshalling.
+    /// Only valid until the array is resized.
+    /// </summary>
+    /// <returns> A span over the elements of the array. </returns>
+    /// <exception cref="InvalidOperationException"> Thrown if the elements aren't blittable. </exception>
+    public Span<T> AsSpan()
+    {
+        return GetNativeSpan();
+    }
+
     /// <summary>
     /// Removes all elements from the array.
     /// </summary>
@@ -85,11 +169,7 @@ public class Array<T> : UnrealArrayBase<T>, IList<T>
     /// <param name="arrayIndex"> The index in the array to start copying to. </param>
     public void CopyTo(T[] array, int arrayIndex)
     {
-        int numElements = Count;
-        for (int i = 0; i < numElements; ++i)
-        {
-            array[i + arrayIndex] = this[i];
-        }
+        CopyTo(array.AsSpan(arrayIndex));
     }
 
     /// <summary>
@@ -1,83 +1,31 @@
-using System.Diagnostics;
-using System.Reflection;
-using System.Runtime.InteropServices;
-
 namespace UnrealSharp.Interop;
 
 public static class ExportedFunctionsManager
 {
-    [UnmanagedFunctionPointer(CallingConvention.Cdecl)] 
-    delegate void NativeFunctionDelegate(IntPtr nativeFunctionPtr);
-    
-    [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
-    unsafe delegate void RegisterFunctionsCallback(IntPtr nativeFunctionPtr, char* nativeFunctionName);
-    
-    private static readonly Dictionary<string, FieldInfo> UnmanagedDelegates = new();
-
-    public static void Initialize(IntPtr NativeExportFunctionsPtr)
+    public static unsafe void Initialize(IntPtr NativeExportFunctionsPtr)
     {
         try
         {
-            unsafe
-            {
-                foreach (Type type in Assembly.GetExecutingAssembly().GetTypes())
-                {
-                    if (!Attribute.IsDefined(type, typeof(NativeCallbacksAttribute)))
-                    {
-                        continue;
-                    }
-
-                    foreach (FieldInfo field in type.GetFields(BindingFlags.Public | BindingFlags.NonPublic |
-                                                               BindingFlags.Static))
-                    {
-                        if (!field.IsStatic || !field.FieldType.IsUnmanagedFunctionPointer)
-                        {
-                            continue;
-                        }
-                        
-                        UnmanagedDelegates.TryAdd(type.Name + "." + field.Name, field);
-                    }
-                }
-
+            var startExportingApi = (delegate* unmanaged<int*, ExportedFunction*>) NativeExportFunctionsPtr;
             
-                NativeFunctionDelegate registerFunctions =
-                    Marshal.GetDelegateForFunctionPointer<NativeFunctionDelegate>(NativeExportFunctionsPtr);
-                IntPtr registerFunctionsCallback =
-                    Marshal.GetFunctionPointerForDelegate<RegisterFunctionsCallback>(RegisterFunctions);
+            int numFunctions;
+            ExportedFunction* exportedFunctions = startExportingApi(&numFunctions);
 
-                registerFunctions(registerFunctionsCallback);
+            for (int i = 0; i < numFunctions; i++)
+            {
+                ExportedFunction exportedFunction = exportedFunctions[i];
                 
-                foreach (KeyValuePair<string, FieldInfo> unmanagedDelegate in UnmanagedDelegates)
+                if (!ExportedFunctionsTable.Bind(exportedFunction.Id, exportedFunction.FunctionPointer))
                 {
-                    if (unmanagedDelegate.Value.GetValue(null) == null)
-                    {
-                        Console.WriteLine($"Failed to initialize {unmanagedDelegate.Key}.");
-                    }
+                    Console.WriteLine($"Failed to find a native callback for exported function with id 0x{exportedFunction.Id:X16}.");
                 }
             }
+            
+            ExportedFunctionsTable.ReportUnboundFunctions();
         }
         catch (Exception ex)
         {
             Console.WriteLine($"Failed to initialize native functions: {ex}");
         }
     }
-
-    private static unsafe void RegisterFunctions(IntPtr nativeFunctionPtr, char* nativeFunctionName)
-    {
-        string nativeFunctionNameString = new string(nativeFunctionName);
-        
-        try
-        {
-            if (!UnmanagedDelegates.TryGetValue(nativeFunctionNameString, out FieldInfo unmanagedDelegate))
-            {
-                throw new Exception($"Failed to find {nativeFunctionNameString} in {nameof(UnmanagedDelegates)}.");
-            }
-            
-            unmanagedDelegate.SetValue(null, nativeFunctionPtr);
-        }
-        catch (Exception e)
-        {
-            Console.WriteLine($"Failed to register native function \"{nativeFunctionNameString}\" exception: {e}");
-        }
-    }
-}
\ No newline at end of file
+}
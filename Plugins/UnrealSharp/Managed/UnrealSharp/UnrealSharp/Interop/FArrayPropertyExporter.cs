@@ -10,4 +10,7 @@ public static unsafe partial class FArrayPropertyExporter
     public static delegate* unmanaged<IntPtr, IntPtr, int, void> RemoveFromArray;
     public static delegate* unmanaged<IntPtr, IntPtr, int, void> ResizeArray;
     public static delegate* unmanaged<IntPtr, IntPtr, int, int, void> SwapValues;
+    public static delegate* unmanaged<IntPtr, IntPtr, int, int> AddRangeToArray;
+    public static delegate* unmanaged<IntPtr, IntPtr, int, int, void> RemoveRangeFromArray;
+    public static delegate* unmanaged<IntPtr, IntPtr, int, void> ReserveArray;
 }
\ No newline at end of file
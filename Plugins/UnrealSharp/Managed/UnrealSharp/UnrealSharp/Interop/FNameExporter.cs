@@ -6,4 +6,5 @@ public static unsafe partial class FNameExporter
     public static delegate* unmanaged<Name, ref UnmanagedArray, void> NameToString;
     public static delegate* unmanaged<ref Name, IntPtr, void> StringToName;
     public static delegate* unmanaged<Name, bool> IsValid;
+    public static delegate* unmanaged<IntPtr, IntPtr, int, void> StringsToNames;
 }
\ No newline at end of file
@@ -3,5 +3,5 @@ namespace UnrealSharp.Interop;
 [NativeCallbacks]
 public unsafe partial class FStringExporter
 {
-    public static delegate* unmanaged<IntPtr, char*, void> MarshalToNativeString;
+    public static delegate* unmanaged<IntPtr, char*, int, void> MarshalToNativeString;
 }
\ No newline at end of file
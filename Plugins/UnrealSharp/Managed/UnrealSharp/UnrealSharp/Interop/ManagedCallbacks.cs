@@ -5,12 +5,18 @@ namespace UnrealSharp.Interop;
 [StructLayout(LayoutKind.Sequential)]
 public unsafe struct ManagedCallbacks
 {
-    public delegate* unmanaged<IntPtr, IntPtr, IntPtr> ScriptManagerBridge_CreateManagedObject;
+    public delegate* unmanaged<IntPtr, IntPtr, NativeBool, IntPtr> ScriptManagerBridge_CreateManagedObject;
     public delegate* unmanaged<IntPtr, delegate*<object, IntPtr, IntPtr, void>, IntPtr, IntPtr, IntPtr, int> ScriptManagerBridge_InvokeManagedMethod;
     public delegate* unmanaged<IntPtr, void> ScriptManagerBridge_InvokeDelegate;
     public delegate* unmanaged<IntPtr, char*, IntPtr> ScriptManagerBridge_LookupManagedMethod;
     public delegate* unmanaged<IntPtr, char*, char*, IntPtr> ScriptManagedBridge_LookupManagedType;
+    public delegate* unmanaged<ManagedObjectCreateInfo*, IntPtr*, int, void> ScriptManagerBridge_CreateManagedObjects;
+    public delegate* unmanaged<ManagedTickEntry*, int, void> ScriptManagerBridge_TickManagedObjects;
+    public delegate* unmanaged<IntPtr, IntPtr, delegate* unmanaged<IntPtr, IntPtr, char*, IntPtr, void>, NativeBool> ScriptManagerBridge_GetManagedMethodTable;
+    public delegate* unmanaged<ManagedDelegateListener*, int, IntPtr, IntPtr, int> ScriptManagerBridge_BroadcastManagedDelegate;
+    public delegate* unmanaged<IntPtr, IntPtr, NativeBool, IntPtr> ScriptManagerBridge_RebindManagedObject;
     public delegate* unmanaged<IntPtr, void> ScriptManagedBridge_Dispose;
+    public delegate* unmanaged<IntPtr*, int, void> ScriptManagedBridge_DisposeHandles;
 
     public static ManagedCallbacks Create()
     {
@@ -21,7 +27,13 @@ public unsafe struct ManagedCallbacks
             ScriptManagerBridge_InvokeDelegate = &UnmanagedCallbacks.InvokeDelegate,
             ScriptManagerBridge_LookupManagedMethod = &UnmanagedCallbacks.LookupManagedMethod,
             ScriptManagedBridge_LookupManagedType = &UnmanagedCallbacks.LookupManagedType,
+            ScriptManagerBridge_CreateManagedObjects = &UnmanagedCallbacks.CreateNewManagedObjects,
+            ScriptManagerBridge_TickManagedObjects = &UnmanagedCallbacks.TickManagedObjects,
+            ScriptManagerBridge_GetManagedMethodTable = &UnmanagedCallbacks.GetManagedMethodTable,
+            ScriptManagerBridge_BroadcastManagedDelegate = &UnmanagedCallbacks.BroadcastManagedDelegate,
+            ScriptManagerBridge_RebindManagedObject = &UnmanagedCallbacks.RebindManagedObject,
             ScriptManagedBridge_Dispose = &UnmanagedCallbacks.Dispose,
+            ScriptManagedBridge_DisposeHandles = &UnmanagedCallbacks.DisposeHandles,
         };
     }
 
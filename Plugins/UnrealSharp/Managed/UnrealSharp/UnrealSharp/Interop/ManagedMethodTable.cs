@@ -0,0 +1,45 @@
+﻿using System.Reflection;
+using System.Runtime.InteropServices;
+
+namespace UnrealSharp.Interop;
+
+// Filled by the weaver-generated ManagedMethodTable.Populate of each user assembly,
+// so native code can resolve every Invoke_ method without reflection.
+public sealed unsafe class ManagedMethodTableBuilder
+{
+    public const string TableTypeName = "UnrealSharp.Generated.ManagedMethodTable";
+    public const string PopulateMethodName = "Populate";
+    
+    private readonly IntPtr _userData;
+    private readonly delegate* unmanaged<IntPtr, IntPtr, char*, IntPtr, void> _addEntry;
+    
+    internal ManagedMethodTableBuilder(IntPtr userData, delegate* unmanaged<IntPtr, IntPtr, char*, IntPtr, void> addEntry)
+    {
+        _userData = userData;
+        _addEntry = addEntry;
+    }
+    
+    public void Add(RuntimeTypeHandle type, string methodName, IntPtr functionPointer)
+    {
+        fixed (char* methodNamePtr = methodName)
+        {
+            _addEntry(_userData, type.Value, methodNamePtr, functionPointer);
+        }
+    }
+    
+    internal static bool Populate(Assembly assembly, IntPtr userData, delegate* unmanaged<IntPtr, IntPtr, char*, IntPtr, void> addEntry)
+    {
+        Type? tableType = assembly.GetType(TableTypeName, false);
+        MethodInfo? populateMethod = tableType?.GetMethod(PopulateMethodName, BindingFlags.Static | BindingFlags.Public | BindingFlags.NonPublic);
+        
+        if (populateMethod == null)
+        {
+            // Assembly was woven by an older weaver, native code falls back to LookupManagedMethod.
+            return false;
+        }
+        
+        var populate = (delegate*<ManagedMethodTableBuilder, void>) populateMethod.MethodHandle.GetFunctionPointer();
+        populate(new ManagedMethodTableBuilder(userData, addEntry));
+        return true;
+    }
+}
@@ -0,0 +1,76 @@
+﻿namespace UnrealSharp.Interop;
+
+/// <summary>
+/// The reflection data a generated static constructor needs, resolved with a single native call
+/// instead of one call and name search per property, function and parameter.
+/// </summary>
+public sealed class NativeTypeLayout
+{
+    private readonly Dictionary<string, NativeTypeLayoutEntry> _entries;
+
+    private NativeTypeLayout(Dictionary<string, NativeTypeLayoutEntry> entries)
+    {
+        _entries = entries;
+    }
+
+    /// <summary>
+    /// Resolves the given names on a native class, struct or delegate signature.
+    /// </summary>
+    /// <param name="nativeStruct"> The UStruct to resolve the names on. </param>
+    /// <param name="names"> Null terminated names, packed back to back: "Property", "Function()" or "Function.Parameter". </param>
+    public static unsafe NativeTypeLayout Resolve(IntPtr nativeStruct, string names)
+    {
+        int numNames = 0;
+        foreach (char character in names)
+        {
+            if (character == '\0')
+            {
+                ++numNames;
+            }
+        }
+
+        NativeTypeLayoutEntry[] entries = new NativeTypeLayoutEntry[numNames];
+
+        fixed (char* namesPtr = names)
+        fixed (NativeTypeLayoutEntry* entriesPtr = entries)
+        {
+            UStructExporter.CallResolveTypeLayout(nativeStruct, (IntPtr) namesPtr, numNames, (IntPtr) entriesPtr);
+        }
+
+        Dictionary<string, NativeTypeLayoutEntry> entriesByName = new(numNames);
+        int nameStart = 0;
+        for (int i = 0; i < numNames; ++i)
+        {
+            int nameEnd = names.IndexOf('\0', nameStart);
+            entriesByName[names.Substring(nameStart, nameEnd - nameStart)] = entries[i];
+            nameStart = nameEnd + 1;
+        }
+
+        return new NativeTypeLayout(entriesByName);
+    }
+
+    public int GetOffset(string name)
+    {
+        return _entries[name].Offset;
+    }
+
+    public int GetArrayDim(string name)
+    {
+        return _entries[name].Size;
+    }
+
+    public IntPtr GetProperty(string name)
+    {
+        return _entries[name].Field;
+    }
+
+    public IntPtr GetFunction(string functionName)
+    {
+        return _entries[functionName + "()"].Field;
+    }
+
+    public int GetParamsSize(string functionName)
+    {
+        return _entries[functionName + "()"].Size;
+    }
+}
@@ -4,4 +4,5 @@ namespace UnrealSharp.Interop;
 public static unsafe partial class UStructExporter
 {
     public static delegate* unmanaged<IntPtr, IntPtr, void> InitializeStruct;
+    public static delegate* unmanaged<IntPtr, IntPtr, int, IntPtr, void> ResolveTypeLayout;
 }
\ No newline at end of file
@@ -6,7 +6,7 @@ namespace UnrealSharp.Interop;
 public static class UnmanagedCallbacks
 {
     [UnmanagedCallersOnly]
-    internal static IntPtr CreateNewManagedObject(IntPtr nativeObject, IntPtr typeHandle)
+    internal static IntPtr CreateNewManagedObject(IntPtr nativeObject, IntPtr typeHandle, NativeBool weakHandle)
     {
         try
         {
@@ -29,7 +29,7 @@ public static class UnmanagedCallbacks
                 throw new ArgumentNullException(nameof(nativeObject));
             }
 
-            return UnrealSharpObject.Create(typeToCreate, nativeObject);
+            return UnrealSharpObject.Create(typeToCreate, nativeObject, weakHandle.ToManagedBool());
         }
         catch (Exception ex)
         {
@@ -39,6 +39,145 @@ public static class UnmanagedCallbacks
         return default;
     }
     
+    [UnmanagedCallersOnly]
+    internal static unsafe void CreateNewManagedObjects(ManagedObjectCreateInfo* createInfos, IntPtr* outHandles, int count)
+    {
+        Type? lastType = null;
+        IntPtr lastTypeHandle = IntPtr.Zero;
+        delegate*<object, void> lastConstructor = null;
+        
+        for (int i = 0; i < count; i++)
+        {
+            try
+            {
+                ManagedObjectCreateInfo createInfo = createInfos[i];
+                
+                if (createInfo.NativeObject == IntPtr.Zero)
+                {
+                    throw new ArgumentNullException(nameof(createInfo.NativeObject));
+                }
+
+                // Batches are usually full of the same few types, only resolve the type and constructor when it changes.
+                if (lastType == null || createInfo.TypeHandle != lastTypeHandle)
+                {
+                    lastType = Type.GetTypeFromHandle(RuntimeTypeHandle.FromIntPtr(createInfo.TypeHandle));
+
+                    if (lastType == null)
+                    {
+                        throw new ArgumentNullException(nameof(createInfo.TypeHandle));
+                    }
+                    
+                    lastTypeHandle = createInfo.TypeHandle;
+                    lastConstructor = UnrealSharpObject.GetConstructor(lastType);
+                }
+
+                outHandles[i] = UnrealSharpObject.Create(lastType, createInfo.NativeObject, lastConstructor, createInfo.WeakHandle.ToManagedBool());
+            }
+            catch (Exception ex)
+            {
+                lastType = null;
+                outHandles[i] = default;
+                Console.WriteLine($"Failed to create new managed object: {ex.Message}");
+            }
+        }
+    }
+    
+    [UnmanagedCallersOnly]
+    internal static IntPtr RebindManagedObject(IntPtr oldHandle, IntPtr typeHandle, NativeBool weakHandle)
+    {
+        try
+        {
+            GCHandle foundHandle = GCHandle.FromIntPtr(oldHandle);
+
+            // The old object went away with its assembly, there's no state left to move over.
+            if (foundHandle.Target is not UnrealSharpObject oldObject)
+            {
+                return default;
+            }
+            
+            Type? reloadedType = Type.GetTypeFromHandle(RuntimeTypeHandle.FromIntPtr(typeHandle));
+
+            if (reloadedType == null)
+            {
+                throw new ArgumentNullException(nameof(typeHandle));
+            }
+
+            IntPtr reboundHandle = UnrealSharpObject.Rebind(oldObject, reloadedType, weakHandle.ToManagedBool());
+            
+            // The old object is replaced rather than destroyed, so it isn't disposed.
+            oldObject.ClearNativeObject();
+            GcHandleUtilities.Free(foundHandle);
+            return reboundHandle;
+        }
+        catch (Exception ex)
+        {
+            Console.WriteLine($"Failed to rebind managed object: {ex.Message}");
+        }
+
+        return default;
+    }
+    
+    [UnmanagedCallersOnly]
+    internal static unsafe void TickManagedObjects(ManagedTickEntry* entries, int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            ManagedTickEntry* entry = &entries[i];
+            
+            try
+            {
+                object? managedObject = GCHandle.FromIntPtr(entry->Handle).Target;
+                
+                if (managedObject == null)
+                {
+                    continue;
+                }
+                
+                // ReceiveTick only takes the delta time, so the entry itself serves as the argument buffer.
+                var methodPtr = (delegate*<object, IntPtr, IntPtr, void>) entry->ManagedMethod;
+                methodPtr(managedObject, (IntPtr) (&entry->DeltaTime), IntPtr.Zero);
+            }
+            catch (Exception ex)
+            {
+                // One failing ticker shouldn't stop the rest of the group from ticking.
+                Console.WriteLine($"Exception during TickManagedObjects: {ex}");
+            }
+        }
+    }
+    
+    /// <summary>
+    /// Calls a run of C# listeners of a multicast delegate broadcast, all with the same parameter buffer.
+    /// Stops at the first listener that throws, so the broadcaster can report the exception for that listener and continue with the next one.
+    /// </summary>
+    /// <returns>The index of the listener that threw, or <paramref name="count"/> if all of them ran.</returns>
+    [UnmanagedCallersOnly]
+    internal static unsafe int BroadcastManagedDelegate(ManagedDelegateListener* listeners, int count, IntPtr parameters, IntPtr exceptionTextBuffer)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            try
+            {
+                object? managedObject = GCHandle.FromIntPtr(listeners[i].Handle).Target;
+                
+                if (managedObject == null)
+                {
+                    throw new ArgumentNullException(nameof(managedObject));
+                }
+                
+                // Delegate signatures have no return value.
+                var methodPtr = (delegate*<object, IntPtr, IntPtr, void>) listeners[i].ManagedMethod;
+                methodPtr(managedObject, parameters, IntPtr.Zero);
+            }
+            catch (Exception ex)
+            {
+                HandleManagedMethodException(ex, exceptionTextBuffer);
+                return i;
+            }
+        }
+
+        return count;
+    }
+    
     [UnmanagedCallersOnly]
     public static unsafe IntPtr LookupManagedMethod(IntPtr typeHandlePtr, char* methodName)
     {
@@ -78,6 +217,25 @@ public static class UnmanagedCallbacks
         return default;
     }
 
+    [UnmanagedCallersOnly]
+    internal static unsafe NativeBool GetManagedMethodTable(IntPtr assemblyHandle, IntPtr userData, delegate* unmanaged<IntPtr, IntPtr, char*, IntPtr, void> addEntry)
+    {
+        try
+        {
+            if (GCHandle.FromIntPtr(assemblyHandle).Target is not Assembly loadedAssembly)
+            {
+                throw new InvalidOperationException("The provided assembly handle does not point to a valid assembly.");
+            }
+            
+            return ManagedMethodTableBuilder.Populate(loadedAssembly, userData, addEntry).ToNativeBool();
+        }
+        catch (Exception ex)
+        {
+            Console.WriteLine($"Exception while building the managed method table: {ex}");
+            return NativeBool.False;
+        }
+    }
+    
     [UnmanagedCallersOnly]
     public static unsafe IntPtr LookupManagedType(IntPtr assemblyHandle, char* typeNamespace, char* typeName)
     {
@@ -138,12 +296,18 @@ public static class UnmanagedCallbacks
         }
         catch (Exception ex)
         {
-            StringMarshaller.ToNative(exceptionTextBuffer, 0, ex.ToString());
-            Console.WriteLine($"Exception during InvokeManagedMethod: {ex}");
-            return 1;
+            return HandleManagedMethodException(ex, exceptionTextBuffer);
         }
         return 0;
     }
+    
+    // Called from the catch block of the weaver-generated InvokeUnmanaged_ entry points, so it has to stay public.
+    public static int HandleManagedMethodException(Exception exception, IntPtr exceptionTextBuffer)
+    {
+        StringMarshaller.ToNative(exceptionTextBuffer, 0, exception.ToString());
+        Console.WriteLine($"Exception during InvokeManagedMethod: {exception}");
+        return 1;
+    }
 
     [UnmanagedCallersOnly]
     public static void InvokeDelegate(IntPtr delegatePtr)
@@ -172,6 +336,28 @@ public static class UnmanagedCallbacks
 
     [UnmanagedCallersOnly]
     public static void Dispose(IntPtr handle)
+    {
+        DisposeHandle(handle);
+    }
+    
+    [UnmanagedCallersOnly]
+    internal static unsafe void DisposeHandles(IntPtr* handles, int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            try
+            {
+                DisposeHandle(handles[i]);
+            }
+            catch (Exception ex)
+            {
+                // The rest of the handles still have to be freed, or they would leak.
+                Console.WriteLine($"Exception during DisposeHandles: {ex}");
+            }
+        }
+    }
+
+    private static void DisposeHandle(IntPtr handle)
     {
         if (handle == IntPtr.Zero)
         {
@@ -180,6 +366,12 @@ public static class UnmanagedCallbacks
 
         GCHandle foundHandle = GCHandle.FromIntPtr(handle);
 
+        // The native object is already deleted, even if an override of Dispose doesn't call the base.
+        if (foundHandle.Target is UnrealSharpObject unrealSharpObject)
+        {
+            unrealSharpObject.ClearNativeObject();
+        }
+
         if (foundHandle.Target is IDisposable disposable)
         {
             disposable.Dispose();
@@ -1,4 +1,49 @@
-﻿namespace UnrealSharp;
+﻿using System.Runtime.InteropServices;
+
+namespace UnrealSharp;
+
+// Layout must match FCSManagedObjectCreateInfo in CSManager.h
+[StructLayout(LayoutKind.Sequential)]
+public struct ManagedObjectCreateInfo
+{
+    public IntPtr NativeObject;
+    public IntPtr TypeHandle;
+    public NativeBool WeakHandle;
+}
+
+// Layout must match FCSManagedTickEntry in CSManagedTickSubsystem.h
+[StructLayout(LayoutKind.Sequential)]
+public struct ManagedTickEntry
+{
+    public IntPtr Handle;
+    public IntPtr ManagedMethod;
+    public float DeltaTime;
+}
+
+// Layout must match FCSManagedDelegateListener in FMulticastDelegatePropertyExporter.h
+[StructLayout(LayoutKind.Sequential)]
+public struct ManagedDelegateListener
+{
+    public IntPtr Handle;
+    public IntPtr ManagedMethod;
+}
+
+// Layout must match FCSExportedFunction in FunctionsExporter.h
+[StructLayout(LayoutKind.Sequential)]
+public struct ExportedFunction
+{
+    public ulong Id;
+    public IntPtr FunctionPointer;
+}
+
+// Layout must match FCSTypeLayoutEntry in UStructExporter.h
+[StructLayout(LayoutKind.Sequential)]
+public struct NativeTypeLayoutEntry
+{
+    public IntPtr Field;
+    public int Offset;
+    public int Size;
+}
 
 // Bools are not blittable, so we need to convert them to bytes
 public enum NativeBool : byte
@@ -21,6 +21,18 @@ public unsafe class MapBase<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TValu
 
     internal readonly NativeProperty KeyProperty;
     internal readonly NativeProperty ValueProperty;
+    
+    private FScriptMapLayout Layout;
+    
+    /// <summary>
+    /// Whether the keys have the same layout in managed and native memory and can be viewed with KeysAsSpan.
+    /// </summary>
+    public bool KeysAreBlittable { get; }
+    
+    /// <summary>
+    /// Whether the values have the same layout in managed and native memory and can be viewed with ValuesAsSpan.
+    /// </summary>
+    public bool ValuesAreBlittable { get; }
 
     public MapBase(IntPtr mapProperty, IntPtr address,
         MarshallingDelegates<TKey>.FromNative keyFromNative, MarshallingDelegates<TKey>.ToNative? keyToNative,
@@ -39,21 +51,65 @@ public unsafe class MapBase<TKey, TValue> : IEnumerable<KeyValuePair<TKey, TValu
         
         IntPtr valuePropertyAddress = FMapPropertyExporter.CallGetValueProperty(NativeProperty);
         ValueProperty = new NativeProperty(valuePropertyAddress);
+        
+        Layout = Helper.Layout;
+        KeysAreBlittable = BlittableMarshaller<TKey>.IsBlittable(keyFromNative);
+        ValuesAreBlittable = BlittableMarshaller<TValue>.IsBlittable(valueFromNative);
     }
     
+    // The sparse array of pairs is read directly with the stride from the map layout,
+    // so walking the map doesn't cost native calls per element.
     internal int GetMaxIndex()
     {
-        return Helper.GetMaxIndex();
+        return Map->Pairs.Elements.Data.ArrayNum;
     }
     
     internal bool IsValidIndex(int index)
     {
-        return Helper.IsValidIndex(index);
+        return Map->Pairs.IsAllocated(index);
     }
     
     internal bool GetPairPtr(int index, out IntPtr keyPtr, out IntPtr valuePtr)
     {
-        return Helper.GetPairPtr(index, out keyPtr, out valuePtr);
+        if (!IsValidIndex(index))
+        {
+            keyPtr = IntPtr.Zero;
+            valuePtr = IntPtr.Zero;
+            return false;
+        }
+        
+        // Keys are always at the start of the pair.
+        keyPtr = Map->Pairs.GetElementPtr(index, ref Layout.SetLayout);
+        valuePtr = keyPtr + Layout.ValueOffset;
+        return true;
+    }
+    
+    /// <summary>
+    /// Gets a view over the keys that reads native memory directly. Only valid until the map is modified.
+    /// </summary>
+    /// <exception cref="InvalidOperationException"> Thrown if the keys aren't blittable. </exception>
+    public SparseElementSpan<TKey> KeysAsSpan()
+    {
+        if (!KeysAreBlittable)
+        {
+            throw new InvalidOperationException($"Keys of type {typeof(TKey)} are not blittable and can't be accessed as a span.");
+        }
+        
+        return Map->Pairs.AsSpan<TKey>(ref Layout.SetLayout);
+    }
+    
+    /// <summary>
+    /// Gets a view over the values that reads native memory directly. Only valid until the map is modified.
+    /// </summary>
+    /// <exception cref="InvalidOperationException"> Thrown if the values aren't blittable. </exception>
+    public SparseElementSpan<TValue> ValuesAsSpan()
+    {
+        if (!ValuesAreBlittable)
+        {
+            throw new InvalidOperationException($"Values of type {typeof(TValue)} are not blittable and can't be accessed as a span.");
+        }
+        
+        return Map->Pairs.AsSpan<TValue>(ref Layout.SetLayout, Layout.ValueOffset);
     }
 
     protected void ClearInternal()
@@ -507,12 +563,11 @@ public class MapCopyMarshaller<TKey, TValue>
             int maxIndex = map->GetMaxIndex();
             for (int i = 0; i < maxIndex; ++i)
             {
-                if (!map->IsValidIndex(i))
+                if (!helper.GetPairPtr(i, out IntPtr keyPtr, out IntPtr valuePtr))
                 {
                     continue;
                 }
                 
-                helper.GetPairPtr(i, out IntPtr keyPtr, out IntPtr valuePtr);
                 result.Add(keyFromNative(keyPtr, 0), valueFromNative(valuePtr, 0));
             }
             return result;
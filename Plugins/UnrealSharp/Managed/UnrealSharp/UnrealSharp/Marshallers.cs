@@ -13,6 +13,19 @@ public static class MarshallingDelegates<T>
 
 public static class BlittableMarshaller<T>
 { 
+    private static readonly MarshallingDelegates<T>.FromNative BlittableFromNative = FromNative;
+    
+    /// <summary>
+    /// Whether elements read with the given marshaller have the same layout in managed and native memory,
+    /// which lets containers copy them as one block of memory instead of one element at a time.
+    /// </summary>
+    public static bool IsBlittable(MarshallingDelegates<T>.FromNative fromNative)
+    {
+        return !RuntimeHelpers.IsReferenceOrContainsReferences<T>() 
+               && fromNative != null 
+               && fromNative.Method == BlittableFromNative.Method;
+    }
+    
     public static void ToNative(IntPtr nativeBuffer, int arrayIndex, T obj)
     {
         unsafe
@@ -85,20 +98,54 @@ public static class StringMarshaller
     {
         unsafe
         {
-            IntPtr ustring = nativeBuffer + arrayIndex * sizeof(UnmanagedArray);
-            fixed (char* stringPtr = obj)
+            UnmanagedArray* ustring = (UnmanagedArray*) (nativeBuffer + arrayIndex * sizeof(UnmanagedArray));
+            ReadOnlySpan<char> chars = obj;
+            
+            // An empty FString keeps its allocation, so the next assignment can reuse it.
+            if (chars.IsEmpty)
+            {
+                ustring->ArrayNum = 0;
+                return;
+            }
+            
+            // If the text fits in the current allocation, write it in place without calling into native code.
+            int numChars = chars.Length + 1;
+            if (ustring->ArrayMax >= numChars)
             {
-                FStringExporter.CallMarshalToNativeString(ustring, stringPtr);
+                char* data = (char*) ustring->Data;
+                chars.CopyTo(new Span<char>(data, chars.Length));
+                data[chars.Length] = '\0';
+                ustring->ArrayNum = numChars;
+                return;
+            }
+            
+            fixed (char* stringPtr = chars)
+            {
+                FStringExporter.CallMarshalToNativeString((IntPtr) ustring, stringPtr, chars.Length);
             }
         }
     }
     
     public static string FromNative(IntPtr nativeBuffer, int arrayIndex)
+    {
+        return StringPool.GetOrAdd(AsSpan(nativeBuffer, arrayIndex));
+    }
+    
+    /// <summary>
+    /// Gets the characters of a native FString without copying them, excluding the null terminator.
+    /// Only valid until the string is modified.
+    /// </summary>
+    public static ReadOnlySpan<char> AsSpan(IntPtr nativeBuffer, int arrayIndex)
     {
         unsafe
         {
-            UnmanagedArray nativeString = BlittableMarshaller<UnmanagedArray>.FromNative(nativeBuffer, arrayIndex);
-            return nativeString.Data == IntPtr.Zero ? string.Empty : new string((char*) nativeString.Data);
+            UnmanagedArray* ustring = (UnmanagedArray*) (nativeBuffer + arrayIndex * sizeof(UnmanagedArray));
+            if (ustring->Data == IntPtr.Zero || ustring->ArrayNum <= 1)
+            {
+                return ReadOnlySpan<char>.Empty;
+            }
+            
+            return new ReadOnlySpan<char>(ustring->Data.ToPointer(), ustring->ArrayNum - 1);
         }
     }
     
@@ -28,7 +28,7 @@ public abstract class MulticastDelegate<TDelegate> : DelegateBase<TDelegate> whe
 
     public override void BindUFunction(Object targetObject, Name functionName)
     {
-        FMulticastDelegatePropertyExporter.CallAddDelegate(NativeProperty, NativeDelegate, targetObject.NativeObject, functionName.ToString());
+        FMulticastDelegatePropertyExporter.CallAddDelegate(NativeProperty, NativeDelegate, targetObject.NativeObject, functionName);
     }
 
     public override void BindUFunction(WeakObject<Object> targetObject, Name functionName)
@@ -42,7 +42,7 @@ public abstract class MulticastDelegate<TDelegate> : DelegateBase<TDelegate> whe
         {
             throw new ArgumentException("The callback for a multicast delegate must be a valid UFunction defined on a UClass", nameof(handler));
         }
-        FMulticastDelegatePropertyExporter.CallAddDelegate(NativeProperty, NativeDelegate, targetObject.NativeObject, handler.Method.Name);
+        FMulticastDelegatePropertyExporter.CallAddDelegate(NativeProperty, NativeDelegate, targetObject.NativeObject, new Name(handler.Method.Name));
     }
 
     public void Remove(TDelegate handler)
@@ -51,7 +51,7 @@ public abstract class MulticastDelegate<TDelegate> : DelegateBase<TDelegate> whe
         {
             return;
         }
-        FMulticastDelegatePropertyExporter.CallRemoveDelegate(NativeProperty, NativeDelegate, targetObject.NativeObject, handler.Method.Name);
+        FMulticastDelegatePropertyExporter.CallRemoveDelegate(NativeProperty, NativeDelegate, targetObject.NativeObject, new Name(handler.Method.Name));
     }
 
     public bool Contains(TDelegate handler)
@@ -60,7 +60,7 @@ public abstract class MulticastDelegate<TDelegate> : DelegateBase<TDelegate> whe
         {
             return false;
         }
-        return FMulticastDelegatePropertyExporter.CallContainsDelegate(NativeProperty, NativeDelegate, targetObject.NativeObject, handler.Method.Name).ToManagedBool();
+        return FMulticastDelegatePropertyExporter.CallContainsDelegate(NativeProperty, NativeDelegate, targetObject.NativeObject, new Name(handler.Method.Name)).ToManagedBool();
     }
 
     public void Clear()
@@ -14,15 +14,9 @@ public struct Name : IEquatable<Name>, IComparable<Name>
     
     public static readonly Name None = new(0, 0);
     
-    public Name(string name)
+    public Name(string? name)
     {
-        unsafe
-        {
-            fixed (char* stringPtr = name)
-            {
-                FNameExporter.CallStringToName(ref this, (IntPtr) stringPtr);
-            }
-        }
+        this = string.IsNullOrEmpty(name) ? None : NameCache.FindOrAdd(name);
     }
 
     private Name(int comparisonIndex, int number)
@@ -31,22 +25,28 @@ public struct Name : IEquatable<Name>, IComparable<Name>
         Number = number;
     }
 
+    // The entry in the native name table holding the string this name displays as, without its number.
+    internal int DisplayEntry => DisplayIndex;
+    
+    // Stored one higher than the number the name displays with, so 0 can mean no number.
+    internal int InternalNumber => Number;
+    
+    internal Name WithoutNumber => this with { Number = 0 };
+
     /// <inheritdoc />
     public override string ToString()
     {
-        unsafe
-        {
-            UnmanagedArray buffer = new UnmanagedArray();
-            try
-            {
-                FNameExporter.CallNameToString(this, ref buffer);
-                return new string((char*)buffer.Data);
-            }
-            finally
-            {
-                buffer.Destroy();
-            }
-        }
+        return NameCache.ToString(this);
+    }
+    
+    /// <summary>
+    /// Converts many strings to names at once. Strings that haven't been converted before are resolved in a single native call.
+    /// </summary>
+    /// <param name="names">The strings to convert.</param>
+    /// <param name="outNames">Receives the names, in the same order. Must be at least as long as names.</param>
+    public static void FromStrings(ReadOnlySpan<string> names, Span<Name> outNames)
+    {
+        NameCache.FindOrAdd(names, outNames);
     }
     
     /// <summary>
@@ -77,14 +77,14 @@ public struct Name : IEquatable<Name>, IComparable<Name>
         return !(lhs == rhs);
     }
     
-    public static implicit operator Name(string name)
+    public static implicit operator Name(string? name)
     {
-        return name.Length != 0 ? new Name(name) : None;
+        return new Name(name);
     }
     
     public static implicit operator string(Name name)
     {
-        return name.IsValid() ? name.ToString() : None.ToString();
+        return name.ToString();
     }
     
     public static implicit operator Text(Name name)
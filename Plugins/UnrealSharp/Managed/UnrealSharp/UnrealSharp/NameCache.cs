@@ -0,0 +1,180 @@
+using System.Buffers;
+using System.Collections.Concurrent;
+using UnrealSharp.Interop;
+
+namespace UnrealSharp;
+
+/// <summary>
+/// Caches conversions between strings and names, so names that gameplay code builds over and over
+/// (socket names, tags, function names) only cross into native code the first time.
+/// Entries in the native name table are never removed, so cached names can't go stale.
+/// </summary>
+internal static class NameCache
+{
+    // Gameplay code can build any number of distinct strings, so this cache starts over once it holds this many.
+    private const int MaxCachedStrings = 16384;
+    
+    private static readonly ConcurrentDictionary<string, Name> NamesByString = new();
+    private static int _numCachedStrings;
+    
+    // One string per native name table entry. Numbered names share the entry of their base name.
+    private static readonly ConcurrentDictionary<int, string> StringsByDisplayEntry = new();
+
+    public static Name FindOrAdd(string name)
+    {
+        if (NamesByString.TryGetValue(name, out Name cachedName))
+        {
+            return cachedName;
+        }
+
+        Name newName = default;
+        unsafe
+        {
+            fixed (char* stringPtr = name)
+            {
+                FNameExporter.CallStringToName(ref newName, (IntPtr) stringPtr);
+            }
+        }
+
+        AddName(name, newName);
+        return newName;
+    }
+
+    private static void AddName(string name, Name newName)
+    {
+        if (!NamesByString.TryAdd(name, newName))
+        {
+            return;
+        }
+
+        if (Interlocked.Increment(ref _numCachedStrings) > MaxCachedStrings)
+        {
+            Interlocked.Exchange(ref _numCachedStrings, 0);
+            NamesByString.Clear();
+        }
+    }
+
+    public static string ToString(Name name)
+    {
+        string? baseString = GetBaseString(name);
+        
+        if (baseString == null)
+        {
+            return ToString(Name.None);
+        }
+
+        // Same format as FName::ToString.
+        int number = name.InternalNumber;
+        return number == 0 ? baseString : $"{baseString}_{number - 1}";
+    }
+
+    private static string? GetBaseString(Name name)
+    {
+        if (StringsByDisplayEntry.TryGetValue(name.DisplayEntry, out string? cachedString))
+        {
+            return cachedString;
+        }
+
+        // Only names that didn't come from native code, like uninitialized memory, are invalid. Checked here so it's paid once per entry.
+        Name baseName = name.WithoutNumber;
+        if (!FNameExporter.CallIsValid(baseName))
+        {
+            return null;
+        }
+
+        string newString;
+        unsafe
+        {
+            UnmanagedArray buffer = new UnmanagedArray();
+            try
+            {
+                FNameExporter.CallNameToString(baseName, ref buffer);
+                newString = new string((char*)buffer.Data);
+            }
+            finally
+            {
+                buffer.Destroy();
+            }
+        }
+
+        StringsByDisplayEntry.TryAdd(name.DisplayEntry, newString);
+        return newString;
+    }
+
+    /// <summary>
+    /// Resolves many strings at once. Strings that aren't cached yet are sent to native code in a single call.
+    /// </summary>
+    public static void FindOrAdd(ReadOnlySpan<string> names, Span<Name> outNames)
+    {
+        if (outNames.Length < names.Length)
+        {
+            throw new ArgumentException("Output span is shorter than the input span.", nameof(outNames));
+        }
+
+        int[] missingIndices = ArrayPool<int>.Shared.Rent(names.Length);
+        int numMissing = 0;
+        int missingLength = 0;
+
+        for (int i = 0; i < names.Length; ++i)
+        {
+            if (string.IsNullOrEmpty(names[i]))
+            {
+                outNames[i] = Name.None;
+                continue;
+            }
+            
+            if (NamesByString.TryGetValue(names[i], out Name cachedName))
+            {
+                outNames[i] = cachedName;
+                continue;
+            }
+
+            missingIndices[numMissing++] = i;
+            missingLength += names[i].Length + 1;
+        }
+
+        if (numMissing == 0)
+        {
+            ArrayPool<int>.Shared.Return(missingIndices);
+            return;
+        }
+
+        // Pack the missing strings back to back, null terminated, so native code can resolve them in one call.
+        char[] stringBuffer = ArrayPool<char>.Shared.Rent(missingLength);
+        Name[] nameBuffer = ArrayPool<Name>.Shared.Rent(numMissing);
+
+        try
+        {
+            int offset = 0;
+            for (int i = 0; i < numMissing; ++i)
+            {
+                string name = names[missingIndices[i]];
+                name.CopyTo(stringBuffer.AsSpan(offset));
+                offset += name.Length;
+                stringBuffer[offset++] = '\0';
+            }
+
+            unsafe
+            {
+                fixed (char* stringsPtr = stringBuffer)
+                fixed (Name* namesPtr = nameBuffer)
+                {
+                    FNameExporter.CallStringsToNames((IntPtr) namesPtr, (IntPtr) stringsPtr, numMissing);
+                }
+            }
+
+            for (int i = 0; i < numMissing; ++i)
+            {
+                int nameIndex = missingIndices[i];
+                outNames[nameIndex] = nameBuffer[i];
+                AddName(names[nameIndex], nameBuffer[i]);
+            }
+        }
+        finally
+        {
+            ArrayPool<int>.Shared.Return(missingIndices);
+            ArrayPool<char>.Shared.Return(stringBuffer);
+            ArrayPool<Name>.Shared.Return(nameBuffer);
+        }
+    }
+}
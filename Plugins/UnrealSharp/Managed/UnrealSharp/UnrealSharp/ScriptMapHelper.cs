@@ -24,6 +24,8 @@ public unsafe struct ScriptMapHelper
         set => _map = (FScriptMap*)value;
     }
 
+    public FScriptMapLayout Layout => _mapLayout;
+
     public ScriptMapHelper(IntPtr mapProperty, IntPtr map = default)
     {                        
         this._mapProperty = mapProperty;
@@ -83,17 +85,16 @@ public unsafe struct ScriptMapHelper
 
     public bool GetPairPtr(int index, out IntPtr keyPtr, out IntPtr valuePtr)
     {
-        IntPtr pairPtr = FScriptMapHelperExporter.CallGetPairPtr(_mapProperty, Map, index);
-        
-        if (pairPtr == IntPtr.Zero)
+        if (!_map->Pairs.IsAllocated(index))
         {
             keyPtr = IntPtr.Zero;
             valuePtr = IntPtr.Zero;
             return false;
         }
         
-        keyPtr = new IntPtr(pairPtr + keyProp.Offset);
-        valuePtr = new IntPtr(pairPtr + valueProp.Offset);
+        // Walk the pairs with the stride from the layout instead of asking native code for every pair.
+        keyPtr = _map->Pairs.GetElementPtr(index, ref _mapLayout.SetLayout);
+        valuePtr = keyPtr + _mapLayout.ValueOffset;
         return true;
     }
 
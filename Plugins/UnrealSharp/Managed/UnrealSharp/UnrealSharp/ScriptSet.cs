@@ -49,6 +49,41 @@ public struct ScriptSet
     {
         return FScriptSetExporter.CallAddUninitialized(ref this, ref layout);
     }
+
+    /// <summary>
+    /// Same as IsValidIndex, but reads the allocation flags directly instead of calling into native code.
+    /// Only valid for sets that live in native memory.
+    /// </summary>
+    public bool IsAllocated(int index)
+    {
+        unsafe
+        {
+            return index >= 0 && index < Elements.Data.ArrayNum && (Elements.AllocationFlags.GetData()[index >> 5] & (1u << (index & 31))) != 0;
+        }
+    }
+
+    /// <summary>
+    /// Gets a pointer to the element at the given index using the stride from the layout, without calling into native code.
+    /// </summary>
+    public IntPtr GetElementPtr(int index, ref FScriptSetLayout layout)
+    {
+        return Elements.Data.Data + index * layout.SparseArrayLayout.Size;
+    }
+
+    /// <summary>
+    /// Gets a view over the elements that reads the sparse array directly.
+    /// Only valid for sets that live in native memory and elements that are blittable.
+    /// </summary>
+    /// <param name="layout"> The layout of the set, from FScriptSetExporter.GetScriptSetLayout. </param>
+    /// <param name="offset"> The offset of the viewed value inside each element, e.g. the value offset of a map pair. </param>
+    public SparseElementSpan<T> AsSpan<T>(ref FScriptSetLayout layout, int offset = 0)
+    {
+        unsafe
+        {
+            byte* data = (byte*) Elements.Data.Data + offset;
+            return new SparseElementSpan<T>(data, Elements.AllocationFlags.GetData(), Elements.Data.ArrayNum, layout.SparseArrayLayout.Size);
+        }
+    }
 }
 
 /// <summary>
@@ -115,6 +150,22 @@ public struct FScriptBitArray
     FDefaultBitArrayAllocator AllocatorInstance;
     public int NumBits;
     public int MaxBits;
+
+    /// <summary>
+    /// Gets the words holding the bits. Only valid for bit arrays that live in native memory.
+    /// </summary>
+    public unsafe uint* GetData()
+    {
+        if (AllocatorInstance.SecondaryData != IntPtr.Zero)
+        {
+            return (uint*) AllocatorInstance.SecondaryData;
+        }
+
+        fixed (int* inlineData = AllocatorInstance.InlineData)
+        {
+            return (uint*) inlineData;
+        }
+    }
 }
 
 //FDefaultBitArrayAllocator = TInlineAllocator<4>
@@ -0,0 +1,79 @@
+using System.Runtime.CompilerServices;
+
+namespace UnrealSharp;
+
+/// <summary>
+/// A read-only view over the elements of a native TSet, or the keys or values of a native TMap.
+/// Elements are read straight from the sparse array using the stride from its layout, so iterating doesn't call into native code.
+/// Only valid until the container is modified.
+/// </summary>
+/// <typeparam name="T"> The element type. Must have the same layout in managed and native memory. </typeparam>
+public readonly unsafe ref struct SparseElementSpan<T>
+{
+    private readonly byte* _data;
+    private readonly uint* _allocationFlags;
+    private readonly int _maxIndex;
+    private readonly int _stride;
+
+    internal SparseElementSpan(byte* data, uint* allocationFlags, int maxIndex, int stride)
+    {
+        _data = data;
+        _allocationFlags = allocationFlags;
+        _maxIndex = maxIndex;
+        _stride = stride;
+    }
+
+    /// <summary>
+    /// The (non-inclusive) maximum index of elements. Indices below it may be unallocated.
+    /// </summary>
+    public int MaxIndex => _maxIndex;
+
+    /// <summary>
+    /// Whether there is an element at the given index.
+    /// </summary>
+    public bool IsValidIndex(int index)
+    {
+        return index >= 0 && index < _maxIndex && (_allocationFlags[index >> 5] & (1u << (index & 31))) != 0;
+    }
+
+    /// <summary>
+    /// Gets the element at the given index. The index must be valid.
+    /// </summary>
+    public ref readonly T this[int index]
+    {
+        get
+        {
+            if (!IsValidIndex(index))
+            {
+                throw new IndexOutOfRangeException($"Index {index} is invalid.");
+            }
+
+            return ref Unsafe.AsRef<T>(_data + index * _stride);
+        }
+    }
+
+    public Enumerator GetEnumerator()
+    {
+        return new Enumerator(this);
+    }
+
+    public ref struct Enumerator
+    {
+        private readonly SparseElementSpan<T> _span;
+        private int _index;
+
+        internal Enumerator(SparseElementSpan<T> span)
+        {
+            _span = span;
+            _index = -1;
+        }
+
+        public ref readonly T Current => ref Unsafe.AsRef<T>(_span._data + _index * _span._stride);
+
+        public bool MoveNext()
+        {
+            while (++_index < _span._maxIndex && !_span.IsValidIndex(_index)) { }
+            return _index < _span._maxIndex;
+        }
+    }
+}
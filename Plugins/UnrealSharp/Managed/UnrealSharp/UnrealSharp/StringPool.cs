@@ -0,0 +1,41 @@
+namespace UnrealSharp;
+
+/// <summary>
+/// A small fixed-size cache of recently read strings, keyed by their contents.
+/// Property getters that read the same text over and over get the same managed string back instead of allocating a new one every time.
+/// </summary>
+internal static class StringPool
+{
+    private const int NumEntries = 4096;
+
+    // Longer strings are rarely repeated and would keep a lot of memory alive.
+    private const int MaxPooledLength = 256;
+
+    private static readonly string?[] Entries = new string?[NumEntries];
+
+    public static string GetOrAdd(ReadOnlySpan<char> chars)
+    {
+        if (chars.IsEmpty)
+        {
+            return string.Empty;
+        }
+
+        if (chars.Length > MaxPooledLength)
+        {
+            return new string(chars);
+        }
+
+        int index = string.GetHashCode(chars) & (NumEntries - 1);
+
+        // Reference reads and writes are atomic, so racing threads at worst replace each other's entries.
+        string? pooled = Entries[index];
+        if (pooled != null && chars.SequenceEqual(pooled))
+        {
+            return pooled;
+        }
+
+        string newString = new string(chars);
+        Entries[index] = newString;
+        return newString;
+    }
+}
@@ -26,7 +26,14 @@ public class Text
     
     public Text(string text)
     {
-        FTextExporter.CallFromString(ref Data, text);
+        unsafe
+        {
+            ReadOnlySpan<char> chars = text;
+            fixed (char* stringPtr = chars)
+            {
+                FTextExporter.CallFromString(ref Data, stringPtr, chars.Length);
+            }
+        }
     }
     
     public Text(Name name) : this(name.ToString())
@@ -56,9 +63,12 @@ public class Text
     /// <inheritdoc />
     public override string ToString()
     {
+        // Texts are usually marshalled into a new Text for every read, so the cache lives natively:
+        // the text data keeps its display string up to date for the current culture, and the pool reuses the managed copy.
         unsafe
         {
-            return new string(FTextExporter.CallToString(ref Data));
+            char* displayString = FTextExporter.CallToString(ref Data, out int length);
+            return StringPool.GetOrAdd(new ReadOnlySpan<char>(displayString, length));
         }
     }
     
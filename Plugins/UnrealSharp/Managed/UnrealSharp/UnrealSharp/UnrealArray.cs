@@ -34,6 +34,11 @@ public abstract class UnrealArrayBase<T> : IEnumerable<T>
     protected MarshallingDelegates<T>.ToNative ToNative;
     
     protected IntPtr NativeBuffer { get; }
+    
+    /// <summary>
+    /// Whether the elements have the same layout in managed and native memory, so ranges can be copied as one block.
+    /// </summary>
+    public bool IsBlittable { get; }
 
     [CLSCompliant(false)]
     protected UnrealArrayBase(IntPtr nativeUnrealProperty, IntPtr nativeBuffer, MarshallingDelegates<T>.ToNative toNative, MarshallingDelegates<T>.FromNative fromNative)
@@ -42,6 +47,7 @@ public abstract class UnrealArrayBase<T> : IEnumerable<T>
         NativeBuffer = nativeBuffer;
         FromNative = fromNative;
         ToNative = toNative;
+        IsBlittable = BlittableMarshaller<T>.IsBlittable(fromNative);
     }
 
     /// <summary>
@@ -74,6 +80,59 @@ public abstract class UnrealArrayBase<T> : IEnumerable<T>
         }
     }
 
+    /// <summary>
+    /// Gets a read-only view over the native array data. Only valid until the array is resized.
+    /// </summary>
+    /// <returns> A span over the elements of the array. </returns>
+    /// <exception cref="InvalidOperationException"> Thrown if the elements aren't blittable. </exception>
+    public ReadOnlySpan<T> AsReadOnlySpan()
+    {
+        return GetNativeSpan();
+    }
+
+    /// <summary>
+    /// Copies the elements of the array into the destination span.
+    /// Blittable elements are copied as one block of memory.
+    /// </summary>
+    /// <param name="destination"> The span to copy the elements to. Must be at least as long as the array. </param>
+    /// <exception cref="ArgumentException"> Thrown if the destination is too short. </exception>
+    public void CopyTo(Span<T> destination)
+    {
+        int numElements = Count;
+        if (destination.Length < numElements)
+        {
+            throw new ArgumentException($"Destination is too short. Array size is {numElements}.", nameof(destination));
+        }
+
+        if (IsBlittable)
+        {
+            GetNativeSpan().CopyTo(destination);
+            return;
+        }
+
+        IntPtr arrayBuffer = NativeArrayBuffer;
+        for (int i = 0; i < numElements; ++i)
+        {
+            destination[i] = FromNative(arrayBuffer, i);
+        }
+    }
+
+    /// <summary>
+    /// Gets a span over the native array data.
+    /// </summary>
+    protected Span<T> GetNativeSpan()
+    {
+        if (!IsBlittable)
+        {
+            throw new InvalidOperationException($"Elements of type {typeof(T)} are not blittable and can't be accessed as a span.");
+        }
+
+        unsafe
+        {
+            return new Span<T>(NativeArrayBuffer.ToPointer(), Count);
+        }
+    }
+
     /// <summary>
     /// Clears the array.
     /// </summary>
@@ -161,12 +220,14 @@ public class ArrayCopyMarshaller<T>
     private readonly IntPtr _nativeProperty;
     private readonly MarshallingDelegates<T>.ToNative _innerTypeToNative;
     private readonly MarshallingDelegates<T>.FromNative _innerTypeFromNative;
+    private readonly bool _isBlittable;
 
     public ArrayCopyMarshaller(IntPtr nativeProperty, MarshallingDelegates<T>.ToNative toNative, MarshallingDelegates<T>.FromNative fromNative)
     {
         _nativeProperty = nativeProperty;
         _innerTypeFromNative = fromNative;
         _innerTypeToNative = toNative;
+        _isBlittable = BlittableMarshaller<T>.IsBlittable(fromNative);
     }
 
     public void ToNative(IntPtr nativeBuffer, int arrayIndex, IList<T> obj)
@@ -179,6 +240,12 @@ public class ArrayCopyMarshaller<T>
                 FArrayPropertyExporter.CallEmptyArray(_nativeProperty, (IntPtr)mirror);
                 return;
             }
+            if (_isBlittable && TryGetSpan(obj, out ReadOnlySpan<T> span))
+            {
+                ToNative(nativeBuffer, arrayIndex, span);
+                return;
+            }
+            
             FArrayPropertyExporter.CallInitializeArray(_nativeProperty, (IntPtr)mirror, obj.Count);
             for (int i = 0; i < obj.Count; ++i)
             {
@@ -197,6 +264,12 @@ public class ArrayCopyMarshaller<T>
                 FArrayPropertyExporter.CallEmptyArray(_nativeProperty, (IntPtr)mirror);
                 return;
             }
+            if (_isBlittable && obj is IList<T> list && TryGetSpan(list, out ReadOnlySpan<T> span))
+            {
+                ToNative(nativeBuffer, arrayIndex, span);
+                return;
+            }
+            
             FArrayPropertyExporter.CallInitializeArray(_nativeProperty, (IntPtr)mirror, obj.Count);
             for (int i = 0; i < obj.Count; ++i)
             {
@@ -211,6 +284,13 @@ public class ArrayCopyMarshaller<T>
         {
             UnmanagedArray* mirror = (UnmanagedArray*)(nativeBuffer + arrayIndex * Marshal.SizeOf(typeof(UnmanagedArray)));
             FArrayPropertyExporter.CallInitializeArray(_nativeProperty, (IntPtr)mirror, obj.Length);
+            
+            if (_isBlittable)
+            {
+                obj.CopyTo(new Span<T>(mirror->Data.ToPointer(), obj.Length));
+                return;
+            }
+            
             for (int i = 0; i < obj.Length; ++i)
             {
                 _innerTypeToNative(mirror->Data, i, obj[i]);
@@ -224,6 +304,14 @@ public class ArrayCopyMarshaller<T>
         {
             List<T> result = [];
             UnmanagedArray* array = (UnmanagedArray*)nativeBuffer;
+            
+            if (_isBlittable)
+            {
+                result.AddRange(new ReadOnlySpan<T>(array->Data.ToPointer(), array->ArrayNum));
+                return result;
+            }
+            
+            result.Capacity = array->ArrayNum;
             for (int i = 0; i < array->ArrayNum; ++i)
             {
                 result.Add(_innerTypeFromNative(array->Data, i));
@@ -232,6 +320,22 @@ public class ArrayCopyMarshaller<T>
         }
     }
 
+    private static bool TryGetSpan(IList<T> list, out ReadOnlySpan<T> span)
+    {
+        switch (list)
+        {
+            case T[] array:
+                span = array;
+                return true;
+            case List<T> managedList:
+                span = CollectionsMarshal.AsSpan(managedList);
+                return true;
+            default:
+                span = default;
+                return false;
+        }
+    }
+
     public void DestructInstance(IntPtr nativeBuffer, int arrayIndex)
     {
         unsafe
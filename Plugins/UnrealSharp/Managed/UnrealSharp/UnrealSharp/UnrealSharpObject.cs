@@ -35,19 +35,65 @@ public class UnrealObjectDestroyedException : InvalidOperationException
 /// </summary>
 public class UnrealSharpObject : IDisposable
 {
-    internal static IntPtr Create(Type typeToCreate, IntPtr nativeObjectPtr)
+    internal static IntPtr Create(Type typeToCreate, IntPtr nativeObjectPtr, bool weakHandle)
     {
         unsafe
         {
-            UnrealSharpObject createdObject = (UnrealSharpObject) RuntimeHelpers.GetUninitializedObject(typeToCreate);
-            const BindingFlags bindingFlags = BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance;
-            var foundConstructor = (delegate*<object, void>) typeToCreate.GetConstructor(bindingFlags, Type.EmptyTypes)!.MethodHandle.GetFunctionPointer();
-            createdObject.NativeObject = nativeObjectPtr;
-            foundConstructor(createdObject);
-            return GCHandle.ToIntPtr(GcHandleUtilities.AllocateStrongPointer(createdObject));
+            return Create(typeToCreate, nativeObjectPtr, GetConstructor(typeToCreate), weakHandle);
         }
     }
     
+    internal static unsafe IntPtr Create(Type typeToCreate, IntPtr nativeObjectPtr, delegate*<object, void> constructor, bool weakHandle)
+    {
+        UnrealSharpObject createdObject = (UnrealSharpObject) RuntimeHelpers.GetUninitializedObject(typeToCreate);
+        createdObject.NativeObject = nativeObjectPtr;
+        constructor(createdObject);
+        
+        // Weak handles let wrappers without managed state be collected once C# stops referencing them.
+        GCHandle handle = weakHandle ? GcHandleUtilities.AllocateWeakPointer(createdObject) : GcHandleUtilities.AllocateStrongPointer(createdObject);
+        return GCHandle.ToIntPtr(handle);
+    }
+    
+    internal static unsafe delegate*<object, void> GetConstructor(Type typeToCreate)
+    {
+        const BindingFlags bindingFlags = BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance;
+        return (delegate*<object, void>) typeToCreate.GetConstructor(bindingFlags, Type.EmptyTypes)!.MethodHandle.GetFunctionPointer();
+    }
+    
+    /// <summary>
+    /// Moves the state of a managed object into a new object of the same class from a reloaded assembly, without running its constructor.
+    /// Fields whose value is of a type from the unloaded assembly can't be carried over, and are left at their default.
+    /// </summary>
+    internal static IntPtr Rebind(UnrealSharpObject oldObject, Type reloadedType, bool weakHandle)
+    {
+        const BindingFlags bindingFlags = BindingFlags.Public | BindingFlags.NonPublic | BindingFlags.Instance | BindingFlags.DeclaredOnly;
+        UnrealSharpObject reboundObject = (UnrealSharpObject) RuntimeHelpers.GetUninitializedObject(reloadedType);
+        
+        Type? oldType = oldObject.GetType();
+        for (Type? newType = reloadedType; newType != null && oldType != null; newType = newType.BaseType, oldType = oldType.BaseType)
+        {
+            foreach (FieldInfo newField in newType.GetFields(bindingFlags))
+            {
+                FieldInfo? oldField = oldType.GetField(newField.Name, bindingFlags);
+
+                if (oldField == null)
+                {
+                    continue;
+                }
+                
+                object? value = oldField.GetValue(oldObject);
+
+                if (value == null || newField.FieldType.IsInstanceOfType(value))
+                {
+                    newField.SetValue(reboundObject, value);
+                }
+            }
+        }
+        
+        GCHandle handle = weakHandle ? GcHandleUtilities.AllocateWeakPointer(reboundObject) : GcHandleUtilities.AllocateStrongPointer(reboundObject);
+        return GCHandle.ToIntPtr(handle);
+    }
+    
     /// <summary>
     /// The pointer to the UObject that this C# object represents.
     /// </summary>
@@ -327,6 +373,11 @@ public class UnrealSharpObject : IDisposable
         }
     }
 
+    internal void ClearNativeObject()
+    {
+        NativeObject = IntPtr.Zero;
+    }
+
     /// <inheritdoc />
     public virtual void Dispose()
     {
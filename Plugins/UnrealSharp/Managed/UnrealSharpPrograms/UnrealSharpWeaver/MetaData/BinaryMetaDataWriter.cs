@@ -0,0 +1,236 @@
+﻿using System.Text;
+using UnrealSharpWeaver.NativeTypes;
+
+namespace UnrealSharpWeaver.MetaData;
+
+// Writes the same metadata as the JSON file in a compact binary form, which is what the engine loads at startup.
+// Layout: magic, version, an interned UTF-8 string table, then the classes, structs, enums and interfaces.
+// The read order lives in FCSMetaDataReader and the SerializeFromBinary functions on the native side, keep them in sync.
+public class BinaryMetaDataWriter
+{
+    private const uint Magic = 0x444D5355; // "USMD"
+    private const uint Version = 1;
+    
+    private readonly Dictionary<string, int> _stringIndices = new();
+    private readonly List<string> _strings = [];
+    private readonly BinaryWriter _body;
+
+    private BinaryMetaDataWriter(Stream bodyStream)
+    {
+        _body = new BinaryWriter(bodyStream);
+    }
+
+    public static void WriteFile(ApiMetaData metadata, string filePath)
+    {
+        using MemoryStream bodyStream = new MemoryStream();
+        BinaryMetaDataWriter writer = new BinaryMetaDataWriter(bodyStream);
+        writer.WriteApiMetaData(metadata);
+        writer._body.Flush();
+        
+        using FileStream fileStream = File.Create(filePath);
+        using BinaryWriter fileWriter = new BinaryWriter(fileStream);
+        
+        fileWriter.Write(Magic);
+        fileWriter.Write(Version);
+        fileWriter.Write(writer._strings.Count);
+        
+        foreach (string value in writer._strings)
+        {
+            byte[] bytes = Encoding.UTF8.GetBytes(value);
+            fileWriter.Write(bytes.Length);
+            fileWriter.Write(bytes);
+        }
+        
+        fileWriter.Write(bodyStream.GetBuffer(), 0, (int) bodyStream.Length);
+    }
+
+    private void WriteApiMetaData(ApiMetaData metadata)
+    {
+        WriteArray(metadata.ClassMetaData, WriteClass);
+        WriteArray(metadata.StructMetaData, WriteStruct);
+        WriteArray(metadata.EnumMetaData, WriteEnum);
+        WriteArray(metadata.InterfacesMetaData, WriteInterface);
+    }
+
+    private void WriteClass(ClassMetaData classMetaData)
+    {
+        WriteTypeReference(classMetaData);
+        WriteFlags(classMetaData.ClassFlags);
+        WriteTypeReference(classMetaData.ParentClass);
+        WriteString(classMetaData.ConfigCategory);
+        WriteArray(classMetaData.Interfaces, WriteString);
+        WriteArray(classMetaData.Functions, WriteFunction);
+        WriteArray(classMetaData.VirtualFunctions, function => WriteString(function.Name));
+        WriteArray(classMetaData.Properties, WriteProperty);
+    }
+
+    private void WriteStruct(StructMetaData structMetaData)
+    {
+        // Structs don't carry a namespace or assembly name in the metadata.
+        WriteString(structMetaData.Name);
+        WriteString(null);
+        WriteString(null);
+        WriteMetaDataMap(structMetaData.MetaData);
+        WriteArray(structMetaData.Fields, WriteProperty);
+    }
+
+    private void WriteEnum(EnumMetaData enumMetaData)
+    {
+        WriteTypeReference(enumMetaData);
+        WriteArray(enumMetaData.Items, WriteString);
+    }
+
+    private void WriteInterface(InterfaceMetaData interfaceMetaData)
+    {
+        WriteTypeReference(interfaceMetaData);
+        WriteArray(interfaceMetaData.Functions, WriteFunction);
+    }
+
+    private void WriteFunction(FunctionMetaData function)
+    {
+        WriteMember(function);
+        WriteArray(function.Parameters, WriteProperty);
+        
+        _body.Write(function.ReturnValue != null);
+        if (function.ReturnValue != null)
+        {
+            WriteProperty(function.ReturnValue);
+        }
+        
+        WriteFlags(function.FunctionFlags);
+        _body.Write(function.HasNativeEntryPoint);
+    }
+
+    private void WriteProperty(PropertyMetaData property)
+    {
+        WritePropertyType(property.PropertyDataType);
+        
+        WriteMember(property);
+        WriteFlags(property.PropertyFlags);
+        WriteFlags(property.LifetimeCondition);
+        WriteString(property.BlueprintGetter);
+        WriteString(property.BlueprintSetter);
+        _body.Write(property.IsArray);
+        WriteString(property.RepNotifyFunctionName);
+    }
+
+    private void WritePropertyType(NativeDataType propertyType)
+    {
+        _body.Write((byte) propertyType.PropertyType);
+        _body.Write(propertyType.ArrayDim);
+
+        // Only the property types with their own metadata type on the native side carry a payload.
+        switch (propertyType.PropertyType)
+        {
+            case PropertyType.Enum:
+            case PropertyType.Struct:
+            case PropertyType.Class:
+            case PropertyType.Object:
+            case PropertyType.WeakObject:
+            case PropertyType.SoftObject:
+            case PropertyType.SoftClass:
+                WriteTypeReference(GetInnerType(propertyType));
+                break;
+            case PropertyType.DefaultComponent:
+                NativeDataDefaultComponent defaultComponent = (NativeDataDefaultComponent) propertyType;
+                WriteTypeReference(defaultComponent.InnerType);
+                _body.Write(defaultComponent.IsRootComponent);
+                WriteString(defaultComponent.AttachmentComponent);
+                WriteString(defaultComponent.AttachmentSocket);
+                break;
+            case PropertyType.Delegate:
+            case PropertyType.MulticastInlineDelegate:
+            case PropertyType.MulticastSparseDelegate:
+                WriteFunction(((NativeDataBaseDelegateType) propertyType).Signature!);
+                break;
+            case PropertyType.Array:
+                WriteProperty(((NativeDataContainerType) propertyType).InnerProperty);
+                break;
+            case PropertyType.Map:
+                NativeDataMapType mapType = (NativeDataMapType) propertyType;
+                WriteProperty(mapType.InnerProperty);
+                WriteProperty(mapType.ValueProperty);
+                break;
+        }
+    }
+
+    private static TypeReferenceMetadata? GetInnerType(NativeDataType propertyType)
+    {
+        return propertyType switch
+        {
+            NativeDataCoreStructType coreStructType => coreStructType.InnerType,
+            NativeDataStructType structType => structType.InnerType,
+            NativeDataGenericObjectType objectType => objectType.InnerType,
+            NativeDataEnumType enumType => enumType.InnerProperty,
+            _ => null
+        };
+    }
+
+    private void WriteTypeReference(TypeReferenceMetadata? typeReference)
+    {
+        WriteString(typeReference?.Name);
+        WriteString(typeReference?.Namespace);
+        WriteString(typeReference?.AssemblyName);
+        WriteMetaDataMap(typeReference?.MetaData);
+    }
+
+    private void WriteMember(BaseMetaData member)
+    {
+        WriteString(member.Name);
+        WriteMetaDataMap(member.MetaData);
+    }
+
+    private void WriteMetaDataMap(Dictionary<string, string>? metaData)
+    {
+        if (metaData == null)
+        {
+            _body.Write(0);
+            return;
+        }
+        
+        _body.Write(metaData.Count);
+        foreach (KeyValuePair<string, string> pair in metaData)
+        {
+            WriteString(pair.Key);
+            WriteString(pair.Value);
+        }
+    }
+
+    private void WriteFlags<T>(T flags) where T : Enum
+    {
+        _body.Write(Convert.ToUInt64(flags));
+    }
+
+    private void WriteArray<T>(IReadOnlyCollection<T>? items, Action<T> writeItem)
+    {
+        if (items == null)
+        {
+            _body.Write(0);
+            return;
+        }
+        
+        _body.Write(items.Count);
+        foreach (T item in items)
+        {
+            writeItem(item);
+        }
+    }
+
+    private void WriteString(string? value)
+    {
+        if (value == null)
+        {
+            _body.Write(-1);
+            return;
+        }
+
+        if (!_stringIndices.TryGetValue(value, out int index))
+        {
+            index = _strings.Count;
+            _strings.Add(value);
+            _stringIndices.Add(value, index);
+        }
+        
+        _body.Write(index);
+    }
+}
@@ -11,6 +11,7 @@ public class FunctionMetaData : BaseMetaData
     public PropertyMetaData[] Parameters { get; set; }
     public PropertyMetaData? ReturnValue { get; set; }
     public FunctionFlags FunctionFlags { get; set; }
+    public bool HasNativeEntryPoint { get; set; }
     
     const FunctionFlags RpcFlags = FunctionFlags.NetServer | FunctionFlags.NetClient | FunctionFlags.NetMulticast;
     
@@ -22,6 +23,7 @@ public class FunctionMetaData : BaseMetaData
     public bool HasParameters => Parameters.Length > 0 || HasReturnValue;
     public bool HasReturnValue => ReturnValue != null;
     public bool IsRpc => WeaverHelper.HasAnyFlags(FunctionFlags, RpcFlags);
+    public bool HasBlittableSignature => Parameters.All(param => param.PropertyDataType.IsBlittable) && (ReturnValue == null || ReturnValue.PropertyDataType.IsBlittable);
     // End non-serialized
 
     private const string CallInEditorName = "CallInEditor";
@@ -196,6 +196,7 @@ public static class Program
             UnrealInterfaceProcessor.ProcessInterfaces(interfaces, metadata);
             UnrealStructProcessor.ProcessStructs(structs, metadata, userAssembly);
             UnrealClassProcessor.ProcessClasses(classes, metadata);
+            ManagedMethodTableProcessor.EmitMethodTable(userAssembly);
         }
         catch (Exception ex)
         {
@@ -246,5 +247,9 @@ public static class Program
 
         string metadataFilePath = Path.ChangeExtension(outputPath, "json");
         File.WriteAllText(metadataFilePath, metaDataContent);
+        
+        // The engine loads the binary copy, the JSON file is kept around for tools and debugging.
+        string binaryMetadataFilePath = Path.ChangeExtension(outputPath, "metadata");
+        BinaryMetaDataWriter.WriteFile(metadata, binaryMetadataFilePath);
     }
 }
\ No newline at end of file
@@ -136,9 +136,10 @@ public static class FunctionProcessor
 
     private static void MakeManagedMethodInvoker(TypeDefinition type, FunctionMetaData func, MethodDefinition methodToCall, FunctionParamRewriteInfo[] paramRewriteInfos)
     {
+        // Internal, so the generated ManagedMethodTable can take its address.
         MethodDefinition invokerFunction = WeaverHelper.AddMethodToType(type, "Invoke_" + func.Name, 
             WeaverHelper.VoidTypeRef, 
-            MethodAttributes.Private, 
+            MethodAttributes.Assembly, 
             [WeaverHelper.IntPtrType, WeaverHelper.IntPtrType]);
 
         ILProcessor processor = invokerFunction.Body.GetILProcessor();
@@ -236,6 +237,61 @@ public static class FunctionProcessor
         }
         
         WeaverHelper.FinalizeMethod(invokerFunction);
+        ManagedMethodTableProcessor.AddMethod(invokerFunction);
+
+        if (func.HasBlittableSignature)
+        {
+            MakeNativeEntryPoint(type, func, invokerFunction);
+        }
+    }
+
+    // Emits a static [UnmanagedCallersOnly] InvokeUnmanaged_ method that native code can call directly,
+    // skipping the generic InvokeManagedMethod bridge. Only used when every parameter is blittable.
+    private static void MakeNativeEntryPoint(TypeDefinition type, FunctionMetaData func, MethodDefinition invokerFunction)
+    {
+        MethodDefinition entryPoint = WeaverHelper.AddMethodToType(type, "InvokeUnmanaged_" + func.Name,
+            WeaverHelper.Int32TypeRef,
+            MethodAttributes.Assembly | MethodAttributes.Static,
+            [WeaverHelper.IntPtrType, WeaverHelper.IntPtrType, WeaverHelper.IntPtrType, WeaverHelper.IntPtrType]);
+        
+        entryPoint.CustomAttributes.Add(new CustomAttribute(WeaverHelper.UnmanagedCallersOnlyConstructor));
+        
+        VariableDefinition result = WeaverHelper.AddVariableToMethod(entryPoint, WeaverHelper.Int32TypeRef);
+        ILProcessor processor = entryPoint.Body.GetILProcessor();
+        Instruction loadResult = processor.Create(OpCodes.Ldloc, result);
+        
+        Instruction tryStart = processor.Create(OpCodes.Ldarg_0);
+        processor.Append(tryStart);
+        processor.Emit(OpCodes.Call, WeaverHelper.GetObjectFromHandlePtrMethod);
+        processor.Emit(OpCodes.Castclass, type);
+        processor.Emit(OpCodes.Ldarg_1);
+        processor.Emit(OpCodes.Ldarg_2);
+        processor.Emit(OpCodes.Call, invokerFunction);
+        processor.Emit(OpCodes.Ldc_I4_0);
+        processor.Emit(OpCodes.Stloc, result);
+        processor.Emit(OpCodes.Leave, loadResult);
+        
+        // The exception object is already on the stack when the handler starts.
+        Instruction handlerStart = processor.Create(OpCodes.Ldarg_3);
+        processor.Append(handlerStart);
+        processor.Emit(OpCodes.Call, WeaverHelper.HandleManagedMethodExceptionMethod);
+        processor.Emit(OpCodes.Stloc, result);
+        processor.Emit(OpCodes.Leave, loadResult);
+        
+        processor.Append(loadResult);
+        processor.Emit(OpCodes.Ret);
+        
+        entryPoint.Body.ExceptionHandlers.Add(new ExceptionHandler(ExceptionHandlerType.Catch)
+        {
+            TryStart = tryStart,
+            TryEnd = handlerStart,
+            HandlerStart = handlerStart,
+            HandlerEnd = loadResult,
+            CatchType = WeaverHelper.HandleManagedMethodExceptionMethod.Parameters[0].ParameterType,
+        });
+        
+        func.HasNativeEntryPoint = true;
+        ManagedMethodTableProcessor.AddMethod(entryPoint);
     }
 
     public static void RewriteMethodAsUFunctionInvoke(TypeDefinition type, FunctionMetaData func, FieldDefinition? paramsSizeField, FunctionParamRewriteInfo[] paramRewriteInfos)
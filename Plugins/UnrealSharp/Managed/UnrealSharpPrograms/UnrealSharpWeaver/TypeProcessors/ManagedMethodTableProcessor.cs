@@ -0,0 +1,75 @@
+﻿using Mono.Cecil;
+using Mono.Cecil.Cil;
+
+namespace UnrealSharpWeaver.TypeProcessors;
+
+// Collects every method native code looks up by name (Invoke_ and InvokeUnmanaged_),
+// and emits UnrealSharp.Generated.ManagedMethodTable so they can all be resolved in one call at load time.
+// The table is a separate type, so the methods are emitted as internal for its ldftn to pass the access check.
+public static class ManagedMethodTableProcessor
+{
+    private const string TableNamespace = "UnrealSharp.Generated";
+    private const string TableName = "ManagedMethodTable";
+    private const string PopulateMethodName = "Populate";
+    
+    private static readonly List<MethodDefinition> TableMethods = [];
+    
+    public static void AddMethod(MethodDefinition method)
+    {
+        // Methods of types the table can't see stay out of it, native code finds them through LookupManagedMethod instead.
+        if (!IsAccessibleFromAssembly(method.DeclaringType))
+        {
+            return;
+        }
+        
+        TableMethods.Add(method);
+    }
+    
+    private static bool IsAccessibleFromAssembly(TypeDefinition type)
+    {
+        for (TypeDefinition? current = type; current is { IsNested: true }; current = current.DeclaringType)
+        {
+            if (!current.IsNestedPublic && !current.IsNestedAssembly && !current.IsNestedFamilyOrAssembly)
+            {
+                return false;
+            }
+        }
+        
+        return true;
+    }
+    
+    public static void EmitMethodTable(AssemblyDefinition userAssembly)
+    {
+        List<MethodDefinition> tableMethods = [..TableMethods];
+        TableMethods.Clear();
+        
+        if (tableMethods.Count == 0)
+        {
+            return;
+        }
+        
+        TypeReference builderType = WeaverHelper.FindTypeInAssembly(WeaverHelper.BindingsAssembly, "ManagedMethodTableBuilder", WeaverHelper.InteropNameSpace)!;
+        MethodReference addMethod = WeaverHelper.FindMethod(builderType.Resolve(), "Add")!;
+        
+        TypeDefinition tableType = WeaverHelper.CreateNewClass(userAssembly, TableNamespace, TableName, 
+            TypeAttributes.NotPublic | TypeAttributes.Abstract | TypeAttributes.Sealed | TypeAttributes.BeforeFieldInit);
+        
+        MethodDefinition populateMethod = WeaverHelper.AddMethodToType(tableType, PopulateMethodName, 
+            WeaverHelper.VoidTypeRef, 
+            MethodAttributes.Public | MethodAttributes.Static, 
+            builderType);
+        
+        ILProcessor processor = populateMethod.Body.GetILProcessor();
+        
+        foreach (MethodDefinition method in tableMethods)
+        {
+            processor.Emit(OpCodes.Ldarg_0);
+            processor.Emit(OpCodes.Ldtoken, method.DeclaringType);
+            processor.Emit(OpCodes.Ldstr, method.Name);
+            processor.Emit(OpCodes.Ldftn, method);
+            processor.Emit(OpCodes.Callvirt, addMethod);
+        }
+        
+        WeaverHelper.FinalizeMethod(populateMethod);
+    }
+}
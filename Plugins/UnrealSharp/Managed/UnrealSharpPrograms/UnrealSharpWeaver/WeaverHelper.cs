@@ -59,6 +59,9 @@ public static class WeaverHelper
     public static MethodReference InvokeNativeFunctionMethod;
     public static MethodReference GetSignatureFunction;
     public static MethodReference InitializeStructMethod;
+    public static MethodReference GetObjectFromHandlePtrMethod;
+    public static MethodReference HandleManagedMethodExceptionMethod;
+    public static MethodReference UnmanagedCallersOnlyConstructor;
     
     private static readonly MethodAttributes MethodAttributes = MethodAttributes.Public | MethodAttributes.Static;
     
@@ -100,6 +103,15 @@ public static class WeaverHelper
         InvokeNativeFunctionMethod = FindExporterMethod(UObjectCallbacks, "CallInvokeNativeFunction");
         GetSignatureFunction = FindExporterMethod(MulticastDelegatePropertyCallbacks, "CallGetSignatureFunction");
         InitializeStructMethod = FindExporterMethod(UStructCallbacks, "CallInitializeStruct");
+        
+        GetObjectFromHandlePtrMethod = FindBindingsStaticMethod(UnrealSharpNamespace, "GcHandleUtilities", "GetObjectFromHandlePtr",
+            method => !method.HasGenericParameters && method.Parameters.Count == 1 && method.Parameters[0].ParameterType.FullName == "System.IntPtr");
+        HandleManagedMethodExceptionMethod = FindBindingsStaticMethod(InteropNameSpace, "UnmanagedCallbacks", "HandleManagedMethodException");
+        
+        // Borrow the attribute constructor from the bindings so the user assembly references the same runtime assembly.
+        MethodDefinition invokeManagedMethod = FindBindingsStaticMethod(InteropNameSpace, "UnmanagedCallbacks", "InvokeManagedMethod").Resolve();
+        CustomAttribute unmanagedCallersOnly = invokeManagedMethod.CustomAttributes.First(attribute => attribute.AttributeType.Name == "UnmanagedCallersOnlyAttribute");
+        UnmanagedCallersOnlyConstructor = ImportMethod(unmanagedCallersOnly.Constructor);
     }
     
     public static TypeReference FindGenericTypeInAssembly(AssemblyDefinition assembly, string typeNamespace, string typeName, TypeReference[] typeParameters)
@@ -146,7 +158,7 @@ public static class WeaverHelper
         throw new Exception($"{fieldName} not found in {typeDef}.");
     }
 
-    public static MethodReference FindBindingsStaticMethod(string findNamespace, string findClass, string findMethod)
+    public static MethodReference FindBindingsStaticMethod(string findNamespace, string findClass, string findMethod, Func<MethodDefinition, bool>? predicate = null)
     {
         foreach (var module in BindingsAssembly.Modules)
         {
@@ -159,7 +171,7 @@ public static class WeaverHelper
 
                 foreach (var method in type.Methods)
                 {
-                    if (method.IsStatic && method.Name == findMethod)
+                    if (method.IsStatic && method.Name == findMethod && (predicate == null || predicate(method)))
                     {
                         return UserAssembly.MainModule.ImportReference(method);
                     }
@@ -2,6 +2,7 @@
 #include "CSharpForUE.h"
 #include "Misc/Paths.h"
 #include "CSManager.h"
+#include "CSManagedCallbacksCache.h"
 
 bool FCSAssembly::Load()
 {
@@ -34,6 +35,34 @@ bool FCSAssembly::Unload() const
 	return FCSManager::ManagedPluginsCallbacks.UnloadPlugin(*AssemblyPath);
 }
 
+void FCSAssembly::LoadManagedMethodTable()
+{
+	ManagedMethods.Reset();
+
+	if (!FCSManagedCallbacks::ManagedCallbacks.GetManagedMethodTable(Assembly.Handle, this, &FCSAssembly::AddManagedMethod))
+	{
+		UE_LOG(LogUnrealSharp, Display, TEXT("%s has no managed method table, falling back to reflection lookups."), *AssemblyName);
+	}
+}
+
+void* FCSAssembly::FindManagedMethod(uint8* TypeHandle, const FName& MethodName) const
+{
+	const TMap<FName, void*>* TypeMethods = ManagedMethods.Find(TypeHandle);
+	if (!TypeMethods)
+	{
+		return nullptr;
+	}
+
+	void* const* FunctionPointer = TypeMethods->Find(MethodName);
+	return FunctionPointer ? *FunctionPointer : nullptr;
+}
+
+void __stdcall FCSAssembly::AddManagedMethod(void* UserData, uint8* TypeHandle, const TCHAR* MethodName, void* FunctionPointer)
+{
+	FCSAssembly* Assembly = static_cast<FCSAssembly*>(UserData);
+	Assembly->ManagedMethods.FindOrAdd(TypeHandle).Add(MethodName, FunctionPointer);
+}
+
 bool FCSAssembly::IsAssemblyValid() const
 {
 	return !Assembly.IsNull();
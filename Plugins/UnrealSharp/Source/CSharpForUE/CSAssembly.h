@@ -26,6 +26,10 @@ struct CSHARPFORUE_API FCSAssembly
 	bool Load();
 	bool Unload() const;
 
+	// Fetches every Invoke_ method the weaver registered for this assembly in a single managed call.
+	void LoadManagedMethodTable();
+	void* FindManagedMethod(uint8* TypeHandle, const FName& MethodName) const;
+
 	bool IsAssemblyValid() const;
 	
 	const GCHandleIntPtr& GetAssemblyHandle() const { return Assembly.Handle; }
@@ -34,7 +38,11 @@ struct CSHARPFORUE_API FCSAssembly
 
 private:
 	
+	static void __stdcall AddManagedMethod(void* UserData, uint8* TypeHandle, const TCHAR* MethodName, void* FunctionPointer);
+	
 	FGCHandle Assembly;
+
+	TMap<uint8*, TMap<FName, void*>> ManagedMethods;
 	
 	FString AssemblyPath;
 	FString AssemblyName;
@@ -18,5 +18,26 @@ public:
 	// Whether Hot Reload should wait for the Editor to gain focus
 	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Hot Reload")
 	bool bRequireFocusForHotReload = false;
+
+	// Tick C# actors and components that only override ReceiveTick in one managed call per tick group, instead of one call per object.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Performance")
+	bool bBatchManagedTicks = false;
+
+	// Only build C# classes, structs, enums and interfaces the first time they are looked up, instead of all of them at startup.
+	// Loading a package builds the types it references, as recorded when cooking next to the user's assembly.
+	// Without that list, all types are built at startup.
+	// Ignored in the editor, which needs every type to exist up front.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Performance")
+	bool bLazyTypeConstruction = false;
+
+	// Types that are still built at startup when lazy type construction is enabled.
+	// Needed for types that are looked up by path before any content that references them is loaded, e.g. from config.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Performance", meta = (EditCondition = "bLazyTypeConstruction"))
+	TArray<FName> EagerlyConstructedTypes;
+
+	// Let C# wrappers of objects without a C# class be garbage collected when C# no longer references them.
+	// A new wrapper is created the next time the object is passed to C#.
+	UPROPERTY(EditDefaultsOnly, config, Category = "UnrealSharp | Performance")
+	bool bWeakHandlesForNativeObjects = false;
 	
 };
@@ -1,6 +1,9 @@
 ﻿#pragma once
 
 struct FInvokeManagedMethodData;
+struct FCSManagedObjectCreateInfo;
+struct FCSManagedTickEntry;
+struct FCSManagedDelegateListener;
 struct GCHandleIntPtr;
 struct FGCHandle;
 
@@ -10,24 +13,37 @@ class CSHARPFORUE_API FCSManagedCallbacks
 
 	struct FManagedCallbacks
 	{
-		using ManagedCallbacks_CreateNewManagedObject = GCHandleIntPtr(__stdcall*)(void*, void*);
+		using ManagedCallbacks_CreateNewManagedObject = GCHandleIntPtr(__stdcall*)(void*, void*, bool);
+		using ManagedCallbacks_CreateNewManagedObjects = void(__stdcall*)(const FCSManagedObjectCreateInfo*, GCHandleIntPtr*, int32);
+		using ManagedCallbacks_TickManagedObjects = void(__stdcall*)(FCSManagedTickEntry*, int32);
+		using ManagedCallbacks_AddManagedMethod = void(__stdcall*)(void*, uint8*, const TCHAR*, void*);
+		using ManagedCallbacks_GetManagedMethodTable = bool(__stdcall*)(GCHandleIntPtr, void*, ManagedCallbacks_AddManagedMethod);
+		using ManagedCallbacks_BroadcastManagedDelegate = int32(__stdcall*)(const FCSManagedDelegateListener*, int32, void*, void*);
+		using ManagedCallbacks_RebindManagedObject = GCHandleIntPtr(__stdcall*)(GCHandleIntPtr, void*, bool);
 		using ManagedCallbacks_InvokeManagedEvent = int(__stdcall*)(GCHandleIntPtr, void*, void*, void*, void*);
 		using ManagedCallbacks_InvokeDelegate = int(__stdcall*)(GCHandleIntPtr);
 		using ManagedCallbacks_LookupMethod = void*(__stdcall*)(void*, const TCHAR*);
 		using ManagedCallbacks_LookupType = uint8*(__stdcall*)(GCHandleIntPtr, const TCHAR*, const TCHAR*);
 		using ManagedCallbacks_Dispose = void(__stdcall*)(GCHandleIntPtr);
+		using ManagedCallbacks_DisposeHandles = void(__stdcall*)(const GCHandleIntPtr*, int32);
 		
 		ManagedCallbacks_CreateNewManagedObject CreateNewManagedObject;
 		ManagedCallbacks_InvokeManagedEvent InvokeManagedMethod;
 		ManagedCallbacks_InvokeDelegate InvokeDelegate;
 		ManagedCallbacks_LookupMethod LookupManagedMethod;
 		ManagedCallbacks_LookupType LookupManagedType;
+		ManagedCallbacks_CreateNewManagedObjects CreateNewManagedObjects;
+		ManagedCallbacks_TickManagedObjects TickManagedObjects;
+		ManagedCallbacks_GetManagedMethodTable GetManagedMethodTable;
+		ManagedCallbacks_BroadcastManagedDelegate BroadcastManagedDelegate;
+		ManagedCallbacks_RebindManagedObject RebindManagedObject;
 
 	private:
 		
 		//Only call these from GCHandles.
 		friend FGCHandle;
 		ManagedCallbacks_Dispose Dispose;
+		ManagedCallbacks_DisposeHandles DisposeHandles;
 		
 	};
 	
@@ -13,3 +13,14 @@ void FGCHandle::Dispose()
 	Handle.IntPtr = nullptr;
 	Type = GCHandleType::Null;
 }
+
+void FGCHandle::DisposeAll(TArray<GCHandleIntPtr>& Handles)
+{
+	if (Handles.IsEmpty())
+	{
+		return;
+	}
+
+	FCSManagedCallbacks::ManagedCallbacks.DisposeHandles(Handles.GetData(), Handles.Num());
+	Handles.Reset();
+}
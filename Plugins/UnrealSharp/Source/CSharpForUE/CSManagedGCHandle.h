@@ -1,5 +1,7 @@
 ﻿#pragma once
 
+#include "CoreMinimal.h"
+
 enum class GCHandleType : char
 {
 	Null,
@@ -33,11 +35,18 @@ struct FGCHandle
 
 	bool IsNull() const { return !Handle.IntPtr; }
 	bool IsWeakPointer() const { return Type == GCHandleType::WeakHandle; }
+
+	// A GC handle points at the runtime's handle table slot holding the object reference,
+	// and the slot is cleared when the target of a weak handle is collected. So this doesn't need to call into C#.
+	bool IsTargetAlive() const { return Handle.IntPtr && *reinterpret_cast<void* const*>(Handle.IntPtr) != nullptr; }
 	const GCHandleIntPtr& GetHandle() const { return Handle; }
 	void* GetIntPtr() const { return Handle.IntPtr; };
 	
 	void Dispose();
 
+	// Disposes all handles with a single call into C#, then empties the array.
+	static void DisposeAll(TArray<GCHandleIntPtr>& Handles);
+
 	void operator = (const FGCHandle& Other)
 	{
 		Handle = Other.Handle;
@@ -0,0 +1,303 @@
+﻿#include "CSManagedTickSubsystem.h"
+#include "CSDeveloperSettings.h"
+#include "CSManagedCallbacksCache.h"
+#include "CSManager.h"
+#include "EngineUtils.h"
+#include "TypeGenerator/CSFunction.h"
+#include "TypeGenerator/Register/CSGeneratedClassBuilder.h"
+
+void FCSManagedTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (IsValid(Target))
+	{
+		Target->TickGroup(TickGroup, DeltaTime, TickType);
+	}
+}
+
+FString FCSManagedTickFunction::DiagnosticMessage()
+{
+	return FString::Printf(TEXT("UCSManagedTickSubsystem[%s]"), *UEnum::GetValueAsString(TickGroup.GetValue()));
+}
+
+bool UCSManagedTickSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer))
+	{
+		return false;
+	}
+
+	return GetDefault<UCSDeveloperSettings>()->bBatchManagedTicks;
+}
+
+void UCSManagedTickSubsystem::Deinitialize()
+{
+	Super::Deinitialize();
+
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+	}
+
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	FWorldDelegates::OnWorldPreActorTick.Remove(PreActorTickHandle);
+
+	for (FCSManagedTickFunction& TickFunction : TickFunctions)
+	{
+		if (TickFunction.IsTickFunctionRegistered())
+		{
+			TickFunction.UnRegisterTickFunction();
+		}
+	}
+
+	for (TArray<FCSManagedTicker>& GroupTickers : Tickers)
+	{
+		GroupTickers.Empty();
+	}
+
+	PendingActors.Empty();
+}
+
+void UCSManagedTickSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	for (TActorIterator<AActor> ActorIt(&InWorld); ActorIt; ++ActorIt)
+	{
+		QueueActor(*ActorIt);
+	}
+
+	ActorSpawnedHandle = InWorld.AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &UCSManagedTickSubsystem::QueueActor));
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UCSManagedTickSubsystem::OnLevelAddedToWorld);
+	PreActorTickHandle = FWorldDelegates::OnWorldPreActorTick.AddUObject(this, &UCSManagedTickSubsystem::OnWorldPreActorTick);
+}
+
+bool UCSManagedTickSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UCSManagedTickSubsystem::TickGroup(ETickingGroup Group, float DeltaTime, ELevelTick TickType)
+{
+	TArray<FCSManagedTicker>& GroupTickers = Tickers[Group];
+	DispatchEntries.Reset(GroupTickers.Num());
+	DispatchObjects.Reset(GroupTickers.Num());
+
+	const bool bPaused = TickType == LEVELTICK_PauseTick;
+
+	for (int32 i = GroupTickers.Num() - 1; i >= 0; --i)
+	{
+		const FCSManagedTicker& Ticker = GroupTickers[i];
+		UObject* Object = Ticker.Object.Get();
+
+		if (!IsValid(Object))
+		{
+			GroupTickers.RemoveAtSwap(i, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		// Re-registered by the engine, for example when a component is registered again, or given a tick interval. Let it tick on its own.
+		if (Ticker.TickFunction->IsTickFunctionRegistered() || Ticker.TickFunction->TickInterval > 0.0f)
+		{
+			ReleaseTicker(Ticker);
+			GroupTickers.RemoveAtSwap(i, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		// Same conditions the tick function would have been skipped under.
+		if (!Ticker.TickFunction->IsTickFunctionEnabled() || (bPaused && !Ticker.TickFunction->bTickEvenWhenPaused))
+		{
+			continue;
+		}
+
+		// Components can be moved to another actor, so the owner is looked up every tick.
+		const UActorComponent* Component = Cast<UActorComponent>(Object);
+		const AActor* Owner = Component ? Component->GetOwner() : CastChecked<AActor>(Object);
+		
+		if (Component ? !Component->IsRegistered() : Owner->IsActorBeingDestroyed())
+		{
+			continue;
+		}
+
+		const FGCHandle ManagedObjectHandle = FCSManager::Get().FindManagedObject(Object);
+		if (ManagedObjectHandle.IsNull())
+		{
+			continue;
+		}
+
+		FCSManagedTickEntry& Entry = DispatchEntries.AddDefaulted_GetRef();
+		Entry.Handle = ManagedObjectHandle.GetHandle();
+		Entry.ManagedMethod = Ticker.ReceiveTick->GetManagedMethod();
+		Entry.DeltaTime = Owner ? DeltaTime * Owner->CustomTimeDilation : DeltaTime;
+		DispatchObjects.Add(Object);
+	}
+
+	if (DispatchEntries.IsEmpty())
+	{
+		return;
+	}
+
+	FCSManagedCallbacks::ManagedCallbacks.TickManagedObjects(DispatchEntries.GetData(), DispatchEntries.Num());
+
+	// AActor::Tick and UActorComponent::TickComponent update latent actions right after ReceiveTick, so do the same.
+	UWorld* World = GetWorld();
+	FLatentActionManager& LatentActionManager = World->GetLatentActionManager();
+	
+	for (UObject* Object : DispatchObjects)
+	{
+		if (IsValid(Object))
+		{
+			LatentActionManager.ProcessLatentActions(Object, World->GetDeltaSeconds());
+		}
+	}
+}
+
+int32 UCSManagedTickSubsystem::GetNumTickers() const
+{
+	int32 NumTickers = 0;
+	for (const TArray<FCSManagedTicker>& GroupTickers : Tickers)
+	{
+		NumTickers += GroupTickers.Num();
+	}
+	
+	return NumTickers;
+}
+
+void UCSManagedTickSubsystem::QueueActor(AActor* Actor)
+{
+	if (IsValid(Actor))
+	{
+		PendingActors.Add(Actor);
+	}
+}
+
+void UCSManagedTickSubsystem::OnLevelAddedToWorld(ULevel* Level, UWorld* World)
+{
+	if (World != GetWorld() || !Level)
+	{
+		return;
+	}
+
+	for (AActor* Actor : Level->Actors)
+	{
+		QueueActor(Actor);
+	}
+}
+
+void UCSManagedTickSubsystem::OnWorldPreActorTick(UWorld* World, ELevelTick TickType, float DeltaTime)
+{
+	if (World != GetWorld() || PendingActors.IsEmpty())
+	{
+		return;
+	}
+
+	for (int32 i = PendingActors.Num() - 1; i >= 0; --i)
+	{
+		AActor* Actor = PendingActors[i].Get();
+
+		if (!IsValid(Actor))
+		{
+			PendingActors.RemoveAtSwap(i, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		// BeginPlay sets up the tick functions again, so only take them over once it has run.
+		if (!Actor->HasActorBegunPlay())
+		{
+			continue;
+		}
+
+		RegisterActor(Actor);
+		PendingActors.RemoveAtSwap(i, 1, EAllowShrinking::No);
+	}
+}
+
+void UCSManagedTickSubsystem::RegisterActor(AActor* Actor)
+{
+	if (Actor->AllowReceiveTickEventOnDedicatedServer() || !IsRunningDedicatedServer())
+	{
+		TryRegisterTicker(Actor, Actor->PrimaryActorTick);
+	}
+
+	for (UActorComponent* Component : Actor->GetComponents())
+	{
+		if (IsValid(Component) && Component->IsRegistered() && Component->HasBegunPlay())
+		{
+			TryRegisterTicker(Component, Component->PrimaryComponentTick);
+		}
+	}
+}
+
+void UCSManagedTickSubsystem::TryRegisterTicker(UObject* Object, FTickFunction& TickFunction)
+{
+	if (!TickFunction.bCanEverTick || !TickFunction.IsTickFunctionRegistered() || TickFunction.TickInterval > 0.0f)
+	{
+		return;
+	}
+
+	// Prerequisites only order registered tick functions, so objects that wait on others keep ticking on their own.
+	if (TickFunction.GetPrerequisites().Num() > 0)
+	{
+		return;
+	}
+
+	// Only take over the tick if the native part of the class does nothing but call ReceiveTick.
+	UClass* Class = Object->GetClass();
+	if (!FCSGeneratedClassBuilder::GetFirstManagedClass(Class))
+	{
+		return;
+	}
+
+	UClass* NativeClass = FCSGeneratedClassBuilder::GetFirstNativeClass(Class);
+	if (NativeClass != AActor::StaticClass() && NativeClass != UActorComponent::StaticClass())
+	{
+		return;
+	}
+
+	// Blueprint children may implement ReceiveTick in a graph, which has to run through the normal path.
+	UCSFunction* ReceiveTick = Cast<UCSFunction>(Class->FindFunctionByName(TEXT("ReceiveTick")));
+	if (!ReceiveTick || !ReceiveTick->GetManagedMethod() || ReceiveTick->ParmsSize != sizeof(float))
+	{
+		return;
+	}
+
+	const ETickingGroup Group = TickFunction.TickGroup.GetValue();
+	FCSManagedTickFunction& GroupTickFunction = TickFunctions[Group];
+
+	if (!GroupTickFunction.IsTickFunctionRegistered())
+	{
+		GroupTickFunction.Target = this;
+		GroupTickFunction.TickGroup = Group;
+		GroupTickFunction.EndTickGroup = Group;
+		GroupTickFunction.bCanEverTick = true;
+		GroupTickFunction.bStartWithTickEnabled = true;
+		
+		// Tickers decide for themselves whether they tick while paused.
+		GroupTickFunction.bTickEvenWhenPaused = true;
+		GroupTickFunction.RegisterTickFunction(GetWorld()->PersistentLevel);
+	}
+
+	// Unregistering keeps the enabled state, which SetActorTickEnabled, SetComponentTickEnabled and Deactivate keep updating.
+	TickFunction.UnRegisterTickFunction();
+
+	FCSManagedTicker& Ticker = Tickers[Group].AddDefaulted_GetRef();
+	Ticker.Object = Object;
+	Ticker.TickFunction = &TickFunction;
+	Ticker.ReceiveTick = ReceiveTick;
+}
+
+void UCSManagedTickSubsystem::ReleaseTicker(const FCSManagedTicker& Ticker)
+{
+	UObject* Object = Ticker.Object.Get();
+	if (!IsValid(Object) || Ticker.TickFunction->IsTickFunctionRegistered())
+	{
+		return;
+	}
+
+	const UActorComponent* Component = Cast<UActorComponent>(Object);
+	ULevel* Level = Component ? Component->GetComponentLevel() : CastChecked<AActor>(Object)->GetLevel();
+	
+	if (Level)
+	{
+		Ticker.TickFunction->RegisterTickFunction(Level);
+	}
+}
@@ -0,0 +1,102 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+#include "CSManagedGCHandle.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "CSManagedTickSubsystem.generated.h"
+
+class UCSFunction;
+class UCSManagedTickSubsystem;
+
+// Passed to C# in one array per tick group. DeltaTime doubles as the argument buffer of ReceiveTick.
+struct FCSManagedTickEntry
+{
+	GCHandleIntPtr Handle;
+	void* ManagedMethod = nullptr;
+	float DeltaTime = 0.0f;
+};
+
+struct FCSManagedTicker
+{
+	TWeakObjectPtr<UObject> Object;
+	FTickFunction* TickFunction = nullptr;
+	UCSFunction* ReceiveTick = nullptr;
+};
+
+USTRUCT()
+struct FCSManagedTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	UCSManagedTickSubsystem* Target = nullptr;
+
+	// FTickFunction interface
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+	// End of FTickFunction interface
+};
+
+template<>
+struct TStructOpsTypeTraits<FCSManagedTickFunction> : public TStructOpsTypeTraitsBase2<FCSManagedTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+// Takes over the tick of C# actors and components that only tick to call their managed ReceiveTick,
+// and runs all of them in a single native-to-managed transition per tick group.
+// Their own tick functions are unregistered rather than disabled, so enabling and disabling their tick keeps working.
+// Enabled through UCSDeveloperSettings::bBatchManagedTicks.
+UCLASS()
+class UCSManagedTickSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	// USubsystem interface
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+	// End of USubsystem interface
+
+	// UWorldSubsystem interface
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	// End of UWorldSubsystem interface
+
+	void TickGroup(ETickingGroup Group, float DeltaTime, ELevelTick TickType);
+
+	// Number of actors and components whose tick is currently run by this subsystem.
+	int32 GetNumTickers() const;
+
+protected:
+
+	// UWorldSubsystem interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	// End of UWorldSubsystem interface
+
+private:
+
+	void QueueActor(AActor* Actor);
+	void OnLevelAddedToWorld(ULevel* Level, UWorld* World);
+	void OnWorldPreActorTick(UWorld* World, ELevelTick TickType, float DeltaTime);
+
+	void RegisterActor(AActor* Actor);
+	void TryRegisterTicker(UObject* Object, FTickFunction& TickFunction);
+	static void ReleaseTicker(const FCSManagedTicker& Ticker);
+
+	FCSManagedTickFunction TickFunctions[TG_MAX];
+	TArray<FCSManagedTicker> Tickers[TG_MAX];
+
+	// Actors waiting for BeginPlay, which registers their tick functions again.
+	TArray<TWeakObjectPtr<AActor>> PendingActors;
+
+	// Reused every tick so dispatching doesn't allocate.
+	TArray<FCSManagedTickEntry> DispatchEntries;
+	TArray<UObject*> DispatchObjects;
+
+	FDelegateHandle ActorSpawnedHandle;
+	FDelegateHandle LevelAddedHandle;
+	FDelegateHandle PreActorTickHandle;
+};
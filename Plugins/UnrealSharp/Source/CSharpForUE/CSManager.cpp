@@ -2,6 +2,7 @@
 #include "CSManagedGCHandle.h"
 #include "CSAssembly.h"
 #include "CSharpForUE.h"
+#include "CSDeveloperSettings.h"
 #include "Export/FunctionsExporter.h"
 #include "TypeGenerator/CSClass.h"
 #include "TypeGenerator/Factories/CSPropertyFactory.h"
@@ -12,6 +13,9 @@
 #include "Misc/App.h"
 #include "UObject/Object.h"
 #include "Misc/MessageDialog.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/ScopeRWLock.h"
+#include "Misc/CoreDelegates.h"
 #include "Engine/Blueprint.h"
 #include "UnrealSharpProcHelper/CSProcHelper.h"
 #include <vector>
@@ -74,6 +78,14 @@ void FCSManager::InitializeUnrealSharp()
 	// Listen to GC callbacks.
 	{
 		GUObjectArray.AddUObjectDeleteListener(this);
+		FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FCSManager::FlushPendingDisposals);
+		FCoreDelegates::OnEndFrame.AddRaw(this, &FCSManager::FlushPendingDisposals);
+	}
+
+	// Batch the creation of managed objects spawned while a map is loading.
+	{
+		FCoreUObjectDelegates::PreLoadMap.AddRaw(this, &FCSManager::OnPreLoadMap);
+		FCoreUObjectDelegates::PostLoadMapWithWorld.AddRaw(this, &FCSManager::OnPostLoadMap);
 	}
 
 	// Initialize the C# runtime.
@@ -287,6 +299,9 @@ TSharedPtr<FCSAssembly> FCSManager::LoadAssembly(const FString& AssemblyPath)
 	
 	LoadedPlugins.Add(*NewPlugin->GetAssemblyName(), NewPlugin);
 
+	// Has to happen before the types are registered, since building them resolves their managed methods.
+	NewPlugin->LoadManagedMethodTable();
+
 	// Change from ManagedProjectName.dll > ManagedProjectName.json
 	const FString MetadataPath = FPaths::ChangeExtension(AssemblyPath, "json");
 
@@ -314,8 +329,6 @@ bool FCSManager::UnloadAssembly(const FString& AssemblyName)
 
 FGCHandle FCSManager::CreateNewManagedObject(UObject* Object, UClass* Class)
 {
-	ensureAlways(!UnmanagedToManagedMap.Contains(Object));
-
 	UClass* ObjectClass = FCSGeneratedClassBuilder::GetFirstManagedClass(Class);
 	
 	if (!ObjectClass)
@@ -330,8 +343,9 @@ FGCHandle FCSManager::CreateNewManagedObject(UObject* Object, UClass* Class)
 
 FGCHandle FCSManager::CreateNewManagedObject(UObject* Object, uint8* TypeHandle)
 {
-	FGCHandle NewManagedObject = FCSManagedCallbacks::ManagedCallbacks.CreateNewManagedObject(Object, TypeHandle);
-	NewManagedObject.Type = GCHandleType::StrongHandle;
+	const bool bWeakHandle = ShouldUseWeakHandle(Object);
+	FGCHandle NewManagedObject = FCSManagedCallbacks::ManagedCallbacks.CreateNewManagedObject(Object, TypeHandle, bWeakHandle);
+	NewManagedObject.Type = bWeakHandle ? GCHandleType::WeakHandle : GCHandleType::StrongHandle;
 
 	if (NewManagedObject.IsNull())
 	{
@@ -339,8 +353,121 @@ FGCHandle FCSManager::CreateNewManagedObject(UObject* Object, uint8* TypeHandle)
 		UE_LOG(LogUnrealSharp, Fatal, TEXT("Failed to create managed object for %s"), *Object->GetName());
 		return FGCHandle();
 	}
+
+	StoreManagedObject(GUObjectArray.ObjectToIndex(Object), NewManagedObject);
+	return NewManagedObject;
+}
+
+void FCSManager::CreateNewManagedObjects(TConstArrayView<FCSManagedObjectCreateInfo> CreateInfos, TArray<FGCHandle>& OutHandles)
+{
+	OutHandles.Reset(CreateInfos.Num());
 	
-	return UnmanagedToManagedMap.Add(Object, NewManagedObject);
+	if (CreateInfos.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<GCHandleIntPtr> NewHandles;
+	NewHandles.SetNumZeroed(CreateInfos.Num());
+	FCSManagedCallbacks::ManagedCallbacks.CreateNewManagedObjects(CreateInfos.GetData(), NewHandles.GetData(), CreateInfos.Num());
+
+	for (int32 i = 0; i < CreateInfos.Num(); ++i)
+	{
+		FGCHandle NewManagedObject(NewHandles[i]);
+		NewManagedObject.Type = CreateInfos[i].bWeakHandle ? GCHandleType::WeakHandle : GCHandleType::StrongHandle;
+
+		if (NewManagedObject.IsNull())
+		{
+			// This should never happen.
+			UE_LOG(LogUnrealSharp, Fatal, TEXT("Failed to create managed object for %s"), *CreateInfos[i].Object->GetName());
+			return;
+		}
+
+		StoreManagedObject(GUObjectArray.ObjectToIndex(CreateInfos[i].Object), NewManagedObject);
+		OutHandles.Add(NewManagedObject);
+	}
+}
+
+void FCSManager::CreateNewManagedObjectDeferred(UObject* Object, uint8* TypeHandle)
+{
+	// Batches are only opened on the game thread, objects constructed on other threads never wait.
+	if (IsInGameThread() && ManagedObjectBatchDepth > 0)
+	{
+		// Defaults need their C# constructor to run before they're copied into instances, and objects about to be loaded
+		// need it to run before serialization, so their saved property values aren't overwritten. Only runtime spawns wait.
+		if (!Object->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject | RF_NeedLoad))
+		{
+			FScopeLock Lock(&PendingManagedObjectsLock);
+			PendingManagedObjects.Add({ Object, TypeHandle, ShouldUseWeakHandle(Object) });
+			return;
+		}
+	}
+	
+	CreateNewManagedObject(Object, TypeHandle);
+}
+
+void FCSManager::BeginManagedObjectBatch()
+{
+	check(IsInGameThread());
+	++ManagedObjectBatchDepth;
+}
+
+void FCSManager::EndManagedObjectBatch()
+{
+	check(IsInGameThread() && ManagedObjectBatchDepth > 0);
+	
+	if (--ManagedObjectBatchDepth == 0)
+	{
+		FlushPendingManagedObjects();
+	}
+}
+
+void FCSManager::FlushPendingManagedObjects()
+{
+	TArray<FCSManagedObjectCreateInfo> CreateInfos;
+	
+	{
+		FScopeLock Lock(&PendingManagedObjectsLock);
+		
+		if (PendingManagedObjects.IsEmpty())
+		{
+			return;
+		}
+		
+		CreateInfos = MoveTemp(PendingManagedObjects);
+	}
+
+	TArray<FGCHandle> NewHandles;
+	CreateNewManagedObjects(CreateInfos, NewHandles);
+}
+
+void FCSManager::StoreManagedObject(int32 ObjectIndex, FGCHandle& Handle)
+{
+	FGCHandle ExistingManagedObject;
+	
+	{
+		FWriteScopeLock WriteLock(ManagedObjectHandlesLock);
+		
+		if (!ManagedObjectHandles.IsValidIndex(ObjectIndex))
+		{
+			// Grow to cover the whole object array, so we don't resize for every new object.
+			ManagedObjectHandles.SetNum(FMath::Max(ObjectIndex + 1, GUObjectArray.GetObjectArrayNum()));
+		}
+
+		FGCHandle& Slot = ManagedObjectHandles[ObjectIndex];
+		
+		if (Slot.IsNull())
+		{
+			Slot = Handle;
+			return;
+		}
+
+		ExistingManagedObject = Slot;
+	}
+
+	// Another thread created the managed object while we were creating ours, keep theirs.
+	Handle.Dispose();
+	Handle = ExistingManagedObject;
 }
 
 FGCHandle FCSManager::FindManagedObject(UObject* Object)
@@ -351,21 +478,154 @@ FGCHandle FCSManager::FindManagedObject(UObject* Object)
 		return FGCHandle();
 	}
 
-	if (FGCHandle* Handle = UnmanagedToManagedMap.Find(Object))
+	const int32 ObjectIndex = GUObjectArray.ObjectToIndex(Object);
+	FGCHandle Handle = FindManagedObject(ObjectIndex);
+
+	// Creating a managed object runs its C# constructor and may flush the open batch, which only the game thread does.
+	// Other threads get the objects C# has already seen, and a miss for the rest.
+	if (!IsInGameThread())
+	{
+		return Handle.IsWeakPointer() && !Handle.IsTargetAlive() ? FGCHandle() : Handle;
+	}
+
+	// C# let go of the wrapper and it got collected, replace it with a new one.
+	if (Handle.IsWeakPointer() && !Handle.IsTargetAlive())
 	{
-		return *Handle;
+		RemoveManagedObject(ObjectIndex);
+		Handle = FGCHandle();
+	}
+
+	if (Handle.IsNull())
+	{
+		// The object might be waiting in an open batch, create it along with the rest of the batch.
+		FlushPendingManagedObjects();
+		Handle = FindManagedObject(ObjectIndex);
+	}
+	
+	if (!Handle.IsNull())
+	{
+		return Handle;
 	}
 	
 	return CreateNewManagedObject(Object, Object->GetClass());
 }
 
+FGCHandle FCSManager::FindManagedObject(int32 ObjectIndex) const
+{
+	FReadScopeLock ReadLock(ManagedObjectHandlesLock);
+	
+	if (!ManagedObjectHandles.IsValidIndex(ObjectIndex))
+	{
+		return FGCHandle();
+	}
+	
+	return ManagedObjectHandles[ObjectIndex];
+}
+
 void FCSManager::RemoveManagedObject(UObject* Object)
 {
+	if (!Object)
+	{
+		return;
+	}
+	
+	RemoveManagedObject(GUObjectArray.ObjectToIndex(Object));
+}
+
+void FCSManager::RebindManagedObject(UObject* Object, uint8* TypeHandle)
+{
+	check(IsInGameThread());
+	
+	const int32 ObjectIndex = GUObjectArray.ObjectToIndex(Object);
+	FGCHandle OldManagedObject = FindManagedObject(ObjectIndex);
+
+	if (OldManagedObject.IsNull())
+	{
+		return;
+	}
+
+	FGCHandle ReboundManagedObject = FCSManagedCallbacks::ManagedCallbacks.RebindManagedObject(OldManagedObject.GetHandle(), TypeHandle, OldManagedObject.IsWeakPointer());
+
+	if (ReboundManagedObject.IsNull())
+	{
+		// Nothing was left to carry over, the object gets a new managed object the next time it's passed to C#.
+		RemoveManagedObject(ObjectIndex);
+		return;
+	}
+
+	ReboundManagedObject.Type = OldManagedObject.Type;
+	
+	FWriteScopeLock WriteLock(ManagedObjectHandlesLock);
+	ManagedObjectHandles[ObjectIndex] = ReboundManagedObject;
+}
+
+void FCSManager::RemoveManagedObject(int32 ObjectIndex)
+{
+	{
+		FScopeLock Lock(&PendingManagedObjectsLock);
+		
+		if (!PendingManagedObjects.IsEmpty())
+		{
+			PendingManagedObjects.RemoveAllSwap([ObjectIndex](const FCSManagedObjectCreateInfo& CreateInfo)
+			{
+				return GUObjectArray.ObjectToIndex(CreateInfo.Object) == ObjectIndex;
+			});
+		}
+	}
+	
 	FGCHandle Handle;
-	if (UnmanagedToManagedMap.RemoveAndCopyValue(Object, Handle))
+	
+	{
+		FWriteScopeLock WriteLock(ManagedObjectHandlesLock);
+		
+		if (!ManagedObjectHandles.IsValidIndex(ObjectIndex))
+		{
+			return;
+		}
+
+		// Clear the slot so it's ready to be reused by the next object with this index.
+		Handle = ManagedObjectHandles[ObjectIndex];
+		ManagedObjectHandles[ObjectIndex] = FGCHandle();
+	}
+
+	if (Handle.IsNull())
+	{
+		return;
+	}
+
+	// Objects are usually deleted by the thousands during garbage collection, so clear the wrappers and free the handles
+	// in one call later instead of one call each. The slot is already cleared, so the object can't be handed to C# again meanwhile.
+	FScopeLock Lock(&PendingDisposalsLock);
+	PendingDisposals.Add(Handle.GetHandle());
+}
+
+bool FCSManager::ShouldUseWeakHandle(const UObject* Object)
+{
+	if (!GetDefault<UCSDeveloperSettings>()->bWeakHandlesForNativeObjects)
 	{
-		Handle.Dispose();
+		return false;
 	}
+
+	return !FCSGeneratedClassBuilder::GetFirstManagedClass(Object->GetClass());
+}
+
+void FCSManager::FlushPendingDisposals()
+{
+	TArray<GCHandleIntPtr> Handles;
+
+	{
+		FScopeLock Lock(&PendingDisposalsLock);
+
+		if (PendingDisposals.IsEmpty())
+		{
+			return;
+		}
+
+		Handles = MoveTemp(PendingDisposals);
+	}
+
+	// Dispose outside the lock, the managed side is free to call back into FindManagedObject.
+	FGCHandle::DisposeAll(Handles);
 }
 
 uint8* FCSManager::GetTypeHandle(const FString& AssemblyName, const FString& Namespace, const FString& TypeName)
@@ -390,6 +650,18 @@ uint8* FCSManager::GetTypeHandle(const FString& AssemblyName, const FString& Nam
 	return TypeHandle;
 }
 
+void* FCSManager::FindManagedMethod(uint8* TypeHandle, const FName& MethodName) const
+{
+	for (const TPair<FName, TSharedPtr<FCSAssembly>>& Plugin : LoadedPlugins)
+	{
+		if (void* ManagedMethod = Plugin.Value->FindManagedMethod(TypeHandle, MethodName))
+		{
+			return ManagedMethod;
+		}
+	}
+	return nullptr;
+}
+
 uint8* FCSManager::GetTypeHandle(const FCSTypeReferenceMetaData& TypeMetaData)
 {
 	return GetTypeHandle(TypeMetaData.AssemblyName.ToString(), TypeMetaData.Namespace.ToString(), TypeMetaData.Name.ToString());
@@ -397,14 +669,36 @@ uint8* FCSManager::GetTypeHandle(const FCSTypeReferenceMetaData& TypeMetaData)
 
 void FCSManager::NotifyUObjectDeleted(const UObjectBase* ObjectBase, int32 Index)
 {
-	UObjectBase* NonConstObject = const_cast<UObjectBase*>(ObjectBase);
-	UObject* Object = static_cast<UObject*>(NonConstObject);
-	RemoveManagedObject(Object);
+	RemoveManagedObject(Index);
+}
+
+void FCSManager::OnPreLoadMap(const FString& MapName)
+{
+	if (bBatchingMapLoad)
+	{
+		return;
+	}
+	
+	bBatchingMapLoad = true;
+	BeginManagedObjectBatch();
+}
+
+void FCSManager::OnPostLoadMap(UWorld* World)
+{
+	if (!bBatchingMapLoad)
+	{
+		return;
+	}
+	
+	bBatchingMapLoad = false;
+	EndManagedObjectBatch();
 }
 
 void FCSManager::OnUObjectArrayShutdown()
 {
 	GUObjectArray.RemoveUObjectDeleteListener(this);
+	FCoreUObjectDelegates::GetPostGarbageCollect().RemoveAll(this);
+	FCoreDelegates::OnEndFrame.RemoveAll(this);
 }
 
 #define LOCTEXT_NAMESPACE "CSManager"
@@ -4,16 +4,25 @@
 #include <hostfxr.h>
 #include "CSAssembly.h"
 #include "CSManagedCallbacksCache.h"
+#include "CSManagedGCHandle.h"
 
 struct FCSTypeReferenceMetaData;
 class FUSScriptEngine;
 class FUSTypeFactory;
 class UObject;
+class UWorld;
 class FUSManagedObject;
 
-struct FGCHandle;
 struct FCSAssembly;
 
+// Passed to C# as one contiguous array when creating managed objects in bulk. Layout must match ManagedObjectCreateInfo in C#.
+struct FCSManagedObjectCreateInfo
+{
+	UObject* Object = nullptr;
+	uint8* TypeHandle = nullptr;
+	bool bWeakHandle = false;
+};
+
 using FInitializeRuntimeHost = bool (*)(const TCHAR*, FCSManagedPluginCallbacks*, FCSManagedCallbacks::FManagedCallbacks*, const void*);
 
 class CSHARPFORUE_API FCSManager : public FUObjectArray::FUObjectDeleteListener
@@ -35,18 +44,33 @@ public:
 
 	FGCHandle CreateNewManagedObject(UObject* Object, UClass* Class);
 	FGCHandle CreateNewManagedObject(UObject* Object, uint8* TypeHandle);
+	void CreateNewManagedObjects(TConstArrayView<FCSManagedObjectCreateInfo> CreateInfos, TArray<FGCHandle>& OutHandles);
+
+	// Creates the managed object right away, or queues it if a managed object batch is open.
+	void CreateNewManagedObjectDeferred(UObject* Object, uint8* TypeHandle);
+
+	void BeginManagedObjectBatch();
+	void EndManagedObjectBatch();
+	void FlushPendingManagedObjects();
 	
+	// Creates the managed object if C# hasn't seen the object yet. Off the game thread, only returns existing managed objects.
 	FGCHandle FindManagedObject(UObject* Object);
+	FGCHandle FindManagedObject(int32 ObjectIndex) const;
 	
 	void RemoveManagedObject(UObject* Object);
 
+	// Replaces the managed object of an object whose class was kept across a reload with one of the reloaded type, carrying its state over.
+	void RebindManagedObject(UObject* Object, uint8* TypeHandle);
+
 	uint8* GetTypeHandle(const FString& AssemblyName, const FString& Namespace, const FString& TypeName);
 	uint8* GetTypeHandle(const FCSTypeReferenceMetaData& TypeMetaData);
 
+	// Searches the method tables of all loaded assemblies. Returns null if no table has the method.
+	void* FindManagedMethod(uint8* TypeHandle, const FName& MethodName) const;
+
 	bool LoadUserAssembly();
 
 	TMap<FName, TSharedPtr<FCSAssembly>> LoadedPlugins;
-	TMap<UObject*, FGCHandle> UnmanagedToManagedMap;
 	
 	static inline FCSManagedPluginCallbacks ManagedPluginsCallbacks;
 
@@ -55,6 +79,17 @@ private:
 	static FUSScriptEngine* UnrealSharpScriptEngine;
 	static UPackage* UnrealSharpPackage;
 	
+	void RemoveManagedObject(int32 ObjectIndex);
+	void StoreManagedObject(int32 ObjectIndex, FGCHandle& Handle);
+
+	// Wrappers of objects without a C# class hold no managed state, so they can be collected when C# no longer references them.
+	static bool ShouldUseWeakHandle(const UObject* Object);
+
+	void FlushPendingDisposals();
+
+	void OnPreLoadMap(const FString& MapName);
+	void OnPostLoadMap(UWorld* World);
+
 	bool LoadRuntimeHost();
 	bool InitializeBindings();
 	
@@ -76,4 +111,35 @@ private:
 	void* UnrealSharpLibraryDLL = nullptr;
 	void* UserScriptsDLL = nullptr;
 	//End
+
+	// Managed handles indexed by the object's GUObjectArray index, kept in sync through NotifyUObjectDeleted.
+	// Guarded by ManagedObjectHandlesLock, since managed objects can be resolved from any thread.
+	TArray<FGCHandle> ManagedObjectHandles;
+	mutable FRWLock ManagedObjectHandlesLock;
+
+	// Objects constructed while a batch is open, created in C# with a single call when the batch is flushed.
+	TArray<FCSManagedObjectCreateInfo> PendingManagedObjects;
+	FCriticalSection PendingManagedObjectsLock;
+
+	// Game thread only. Set between PreLoadMap and PostLoadMapWithWorld.
+	int32 ManagedObjectBatchDepth = 0;
+	bool bBatchingMapLoad = false;
+
+	// Handles of deleted objects, disposed with a single call to C# after garbage collection and at the end of the frame.
+	TArray<GCHandleIntPtr> PendingDisposals;
+	FCriticalSection PendingDisposalsLock;
+};
+
+// Batches the creation of managed objects constructed within this scope into a single call to C#.
+struct FCSScopedManagedObjectBatch
+{
+	FCSScopedManagedObjectBatch()
+	{
+		FCSManager::Get().BeginManagedObjectBatch();
+	}
+
+	~FCSScopedManagedObjectBatch()
+	{
+		FCSManager::Get().EndManagedObjectBatch();
+	}
 };
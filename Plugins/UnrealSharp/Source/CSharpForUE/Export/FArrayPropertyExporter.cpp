@@ -9,6 +9,9 @@ void UFArrayPropertyExporter::ExportFunctions(FRegisterExportedFunction Register
 	EXPORT_FUNCTION(RemoveFromArray)
 	EXPORT_FUNCTION(ResizeArray)
 	EXPORT_FUNCTION(SwapValues)
+	EXPORT_FUNCTION(AddRangeToArray)
+	EXPORT_FUNCTION(RemoveRangeFromArray)
+	EXPORT_FUNCTION(ReserveArray)
 }
 
 void UFArrayPropertyExporter::InitializeArray(FArrayProperty* ArrayProperty, const void* ScriptArray, int Length)
@@ -52,3 +55,45 @@ void UFArrayPropertyExporter::SwapValues(FArrayProperty* ArrayProperty, const vo
 	FScriptArrayHelper Helper(ArrayProperty, ScriptArray);
 	Helper.SwapValues(indexA, indexB);
 }
+
+int UFArrayPropertyExporter::AddRangeToArray(FArrayProperty* ArrayProperty, const void* ScriptArray, int Count)
+{
+	FScriptArrayHelper Helper(ArrayProperty, ScriptArray);
+	return Helper.AddValues(Count);
+}
+
+void UFArrayPropertyExporter::RemoveRangeFromArray(FArrayProperty* ArrayProperty, const void* ScriptArray, int Index, int Count)
+{
+	FScriptArrayHelper Helper(ArrayProperty, ScriptArray);
+	Helper.RemoveValues(Index, Count);
+}
+
+void UFArrayPropertyExporter::ReserveArray(FArrayProperty* ArrayProperty, void* ScriptArray, int Capacity)
+{
+	FScriptArray* Array = static_cast<FScriptArray*>(ScriptArray);
+	if (Capacity <= Array->Max())
+	{
+		return;
+	}
+
+	const int32 ElementSize = ArrayProperty->Inner->ElementSize;
+	const int32 Alignment = ArrayProperty->Inner->GetMinAlignment();
+	const int32 Num = Array->Num();
+
+	if (Num == 0)
+	{
+		Array->Empty(Capacity, ElementSize, Alignment);
+		return;
+	}
+
+	// Unreal containers treat their elements as bitwise relocatable, so the existing
+	// elements can be moved into the larger allocation without running any constructors.
+	const int32 NumBytes = Num * ElementSize;
+	void* Elements = FMemory::Malloc(NumBytes, Alignment);
+	FMemory::Memcpy(Elements, Array->GetData(), NumBytes);
+
+	Array->Empty(Capacity, ElementSize, Alignment);
+	Array->Add(Num, ElementSize, Alignment);
+	FMemory::Memcpy(Array->GetData(), Elements, NumBytes);
+	FMemory::Free(Elements);
+}
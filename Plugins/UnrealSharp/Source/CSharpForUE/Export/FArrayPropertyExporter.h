@@ -26,5 +26,8 @@ private:
 	static void RemoveFromArray(FArrayProperty* ArrayProperty, const void* ScriptArray, int index);
 	static void ResizeArray(FArrayProperty* ArrayProperty, const void* ScriptArray, int Length);
 	static void SwapValues(FArrayProperty* ArrayProperty, const void* ScriptArray, int indexA, int indexB);
+	static int AddRangeToArray(FArrayProperty* ArrayProperty, const void* ScriptArray, int Count);
+	static void RemoveRangeFromArray(FArrayProperty* ArrayProperty, const void* ScriptArray, int Index, int Count);
+	static void ReserveArray(FArrayProperty* ArrayProperty, void* ScriptArray, int Capacity);
 	
 };
@@ -1,4 +1,31 @@
 ﻿#include "FMulticastDelegatePropertyExporter.h"
+#include "CSharpForUE/CSManagedCallbacksCache.h"
+#include "CSharpForUE/CSManager.h"
+#include "CSharpForUE/TypeGenerator/CSClass.h"
+#include "CSharpForUE/TypeGenerator/CSFunction.h"
+
+namespace
+{
+	// The invocation list is protected. Naming it through a derived type gives a member pointer that works on any multicast delegate.
+	struct FCSMulticastDelegateAccess : FMulticastScriptDelegate
+	{
+		static const auto& GetInvocationList(const FMulticastScriptDelegate& Delegate)
+		{
+			return Delegate.*(&FCSMulticastDelegateAccess::InvocationList);
+		}
+	};
+
+	// Only skip ProcessEvent when it would end up in the C# method anyway. RPCs have to be routed through ProcessEvent,
+	// and a function that's been rebound to another thunk no longer runs the C# method.
+	bool CanInvokeManagedMethodDirectly(const UFunction* Function)
+	{
+		const UCSFunction* ManagedFunction = Cast<UCSFunction>(Function);
+		return ManagedFunction
+			&& ManagedFunction->GetManagedMethod()
+			&& !ManagedFunction->HasAnyFunctionFlags(FUNC_Net)
+			&& ManagedFunction->GetNativeFunc() == &UCSClass::InvokeManagedMethod;
+	}
+}
 
 void UFMulticastDelegatePropertyExporter::ExportFunctions(FRegisterExportedFunction RegisterExportedFunction)
 {
@@ -10,13 +37,13 @@ void UFMulticastDelegatePropertyExporter::ExportFunctions(FRegisterExportedFunct
 	EXPORT_FUNCTION(ContainsDelegate)
 }
 
-void UFMulticastDelegatePropertyExporter::AddDelegate(FMulticastDelegateProperty* DelegateProperty, FMulticastScriptDelegate* Delegate, UObject* Target, const char* FunctionName)
+void UFMulticastDelegatePropertyExporter::AddDelegate(FMulticastDelegateProperty* DelegateProperty, FMulticastScriptDelegate* Delegate, UObject* Target, FName FunctionName)
 {
 	FScriptDelegate NewScriptDelegate = MakeScriptDelegate(Target, FunctionName);
 	DelegateProperty->AddDelegate(NewScriptDelegate, nullptr, Delegate);
 }
 
-void UFMulticastDelegatePropertyExporter::RemoveDelegate(FMulticastDelegateProperty* DelegateProperty, FMulticastScriptDelegate* Delegate, UObject* Target, const char* FunctionName)
+void UFMulticastDelegatePropertyExporter::RemoveDelegate(FMulticastDelegateProperty* DelegateProperty, FMulticastScriptDelegate* Delegate, UObject* Target, FName FunctionName)
 {
 	FScriptDelegate NewScriptDelegate = MakeScriptDelegate(Target, FunctionName);
 	DelegateProperty->RemoveDelegate(NewScriptDelegate, nullptr, Delegate);
@@ -30,10 +57,94 @@ void UFMulticastDelegatePropertyExporter::ClearDelegate(FMulticastDelegateProper
 void UFMulticastDelegatePropertyExporter::BroadcastDelegate(FMulticastDelegateProperty* DelegateProperty, const FMulticastScriptDelegate* Delegate, void* Parameters)
 {
 	Delegate = TryGetSparseMulticastDelegate(DelegateProperty, Delegate);
-	Delegate->ProcessMulticastDelegate<UObject>(Parameters);
+	if (!Delegate || !Delegate->IsBound())
+	{
+		return;
+	}
+
+	// Listeners may bind or unbind while the delegate is broadcasting, so work on a copy like ProcessMulticastDelegate does.
+	TArray<FScriptDelegate, TInlineAllocator<16>> InvocationList(FCSMulticastDelegateAccess::GetInvocationList(*Delegate));
+
+	// Consecutive C# listeners are collected and called in one transition.
+	// Their objects and functions are kept on this side, in case one of them throws and has to be reported.
+	TArray<FCSManagedDelegateListener, TInlineAllocator<16>> ManagedListeners;
+	TArray<TPair<UObject*, UFunction*>, TInlineAllocator<16>> ManagedListenerTargets;
+	
+	auto FlushManagedListeners = [&ManagedListeners, &ManagedListenerTargets, Parameters]()
+	{
+		// C# stops at the first listener that throws and returns its index. Report it like ProcessEvent would and carry on after it.
+		int32 FirstListener = 0;
+		while (FirstListener < ManagedListeners.Num())
+		{
+			FString ExceptionMessage;
+			FirstListener += FCSManagedCallbacks::ManagedCallbacks.BroadcastManagedDelegate(ManagedListeners.GetData() + FirstListener,
+				ManagedListeners.Num() - FirstListener,
+				Parameters,
+				&ExceptionMessage);
+
+			if (FirstListener < ManagedListeners.Num())
+			{
+				const TPair<UObject*, UFunction*>& Target = ManagedListenerTargets[FirstListener];
+				FFrame Stack(Target.Key, Target.Value, Parameters, nullptr, Target.Value->ChildProperties);
+				UCSClass::ThrowManagedException(Target.Key, Stack, ExceptionMessage);
+				++FirstListener;
+			}
+		}
+		
+		ManagedListeners.Reset();
+		ManagedListenerTargets.Reset();
+	};
+
+	UClass* LastClass = nullptr;
+	FName LastFunctionName;
+	UFunction* LastFunction = nullptr;
+	bool bLastFunctionIsManaged = false;
+	
+	for (const FScriptDelegate& Listener : InvocationList)
+	{
+		UObject* Object = Listener.GetUObject();
+		if (!IsValid(Object))
+		{
+			continue;
+		}
+
+		// Events usually have many listeners of the same class bound to the same function, so only look it up when that changes.
+		const FName FunctionName = Listener.GetFunctionName();
+		if (Object->GetClass() != LastClass || FunctionName != LastFunctionName)
+		{
+			LastClass = Object->GetClass();
+			LastFunctionName = FunctionName;
+			LastFunction = Object->FindFunction(FunctionName);
+			bLastFunctionIsManaged = LastFunction && CanInvokeManagedMethodDirectly(LastFunction);
+		}
+
+		if (!LastFunction)
+		{
+			continue;
+		}
+
+		if (bLastFunctionIsManaged)
+		{
+			const FGCHandle ManagedObjectHandle = FCSManager::Get().FindManagedObject(Object);
+			if (!ManagedObjectHandle.IsNull())
+			{
+				FCSManagedDelegateListener& ManagedListener = ManagedListeners.AddDefaulted_GetRef();
+				ManagedListener.Handle = ManagedObjectHandle.GetHandle();
+				ManagedListener.ManagedMethod = CastChecked<UCSFunction>(LastFunction)->GetManagedMethod();
+				ManagedListenerTargets.Emplace(Object, LastFunction);
+				continue;
+			}
+		}
+
+		// Keep the call order intact when native and C# listeners are mixed.
+		FlushManagedListeners();
+		Object->ProcessEvent(LastFunction, Parameters);
+	}
+
+	FlushManagedListeners();
 }
 
-bool UFMulticastDelegatePropertyExporter::ContainsDelegate(FMulticastDelegateProperty* DelegateProperty, const FMulticastScriptDelegate* Delegate, UObject* Target, const char* FunctionName)
+bool UFMulticastDelegatePropertyExporter::ContainsDelegate(FMulticastDelegateProperty* DelegateProperty, const FMulticastScriptDelegate* Delegate, UObject* Target, FName FunctionName)
 {
 	FScriptDelegate NewScriptDelegate = MakeScriptDelegate(Target, FunctionName);
 	Delegate = TryGetSparseMulticastDelegate(DelegateProperty, Delegate);
@@ -45,7 +156,7 @@ void* UFMulticastDelegatePropertyExporter::GetSignatureFunction(FMulticastDelega
 	return DelegateProperty->SignatureFunction;
 }
 
-FScriptDelegate UFMulticastDelegatePropertyExporter::MakeScriptDelegate(UObject* Target, const char* FunctionName)
+FScriptDelegate UFMulticastDelegatePropertyExporter::MakeScriptDelegate(UObject* Target, FName FunctionName)
 {
 	FScriptDelegate NewDelegate;
 	NewDelegate.BindUFunction(Target, FunctionName);
@@ -4,8 +4,18 @@
 
 #include "CoreMinimal.h"
 #include "FunctionsExporter.h"
+#include "CSharpForUE/CSManagedGCHandle.h"
 #include "FMulticastDelegatePropertyExporter.generated.h"
 
+class UCSFunction;
+
+// A C# listener of a multicast delegate. Consecutive C# listeners are passed to C# as one array, so they're called in a single transition.
+struct FCSManagedDelegateListener
+{
+	GCHandleIntPtr Handle;
+	void* ManagedMethod = nullptr;
+};
+
 struct Interop_FScriptDelegate
 {
 	UObject* Object;
@@ -32,15 +42,15 @@ public:
 
 private:
 
-	static void AddDelegate(FMulticastDelegateProperty* DelegateProperty, FMulticastScriptDelegate* Delegate, UObject* Target, const char* FunctionName);
-	static void RemoveDelegate(FMulticastDelegateProperty* DelegateProperty, FMulticastScriptDelegate* Delegate, UObject* Target, const char* FunctionName);
+	static void AddDelegate(FMulticastDelegateProperty* DelegateProperty, FMulticastScriptDelegate* Delegate, UObject* Target, FName FunctionName);
+	static void RemoveDelegate(FMulticastDelegateProperty* DelegateProperty, FMulticastScriptDelegate* Delegate, UObject* Target, FName FunctionName);
 	static void ClearDelegate(FMulticastDelegateProperty* DelegateProperty, FMulticastScriptDelegate* Delegate);
 	static void BroadcastDelegate(FMulticastDelegateProperty* DelegateProperty, const FMulticastScriptDelegate* Delegate, void* Parameters);
-	static bool ContainsDelegate(FMulticastDelegateProperty* DelegateProperty, const FMulticastScriptDelegate* Delegate, UObject* Target, const char* FunctionName);
+	static bool ContainsDelegate(FMulticastDelegateProperty* DelegateProperty, const FMulticastScriptDelegate* Delegate, UObject* Target, FName FunctionName);
 
 	static void* GetSignatureFunction(FMulticastDelegateProperty* DelegateProperty);
 
-	static FScriptDelegate MakeScriptDelegate(UObject* Target, const char* FunctionName);
+	static FScriptDelegate MakeScriptDelegate(UObject* Target, FName FunctionName);
 	static const FMulticastScriptDelegate* TryGetSparseMulticastDelegate(FMulticastDelegateProperty* DelegateProperty, const FMulticastScriptDelegate* Delegate);
 	
 };
@@ -5,6 +5,7 @@ void UFNameExporter::ExportFunctions(FRegisterExportedFunction RegisterExportedF
 	EXPORT_FUNCTION(NameToString)
 	EXPORT_FUNCTION(StringToName)
 	EXPORT_FUNCTION(IsValid)
+	EXPORT_FUNCTION(StringsToNames)
 }
 
 void UFNameExporter::NameToString(FName Name, FString& OutString)
@@ -21,3 +22,13 @@ bool UFNameExporter::IsValid(FName Name)
 {
 	return Name.IsValid();
 }
+
+void UFNameExporter::StringsToNames(FName* OutNames, const UTF16CHAR* Strings, int32 Count)
+{
+	// The strings are packed back to back, each one null terminated.
+	for (int32 i = 0; i < Count; ++i)
+	{
+		OutNames[i] = FName(Strings);
+		while (*Strings++) {}
+	}
+}
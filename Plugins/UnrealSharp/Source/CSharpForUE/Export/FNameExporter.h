@@ -20,5 +20,6 @@ private:
 	static void NameToString(FName Name, FString& OutString);
 	static void StringToName(FName* Name, const UTF16CHAR* String);
 	static bool IsValid(FName Name);
+	static void StringsToNames(FName* OutNames, const UTF16CHAR* Strings, int32 Count);
 	
 };
@@ -5,7 +5,12 @@ void UFStringExporter::ExportFunctions(FRegisterExportedFunction RegisterExporte
 	EXPORT_FUNCTION(MarshalToNativeString);
 }
 
-void UFStringExporter::MarshalToNativeString(FString* String, TCHAR* ManagedString)
+void UFStringExporter::MarshalToNativeString(FString* String, const TCHAR* ManagedString, int32 Length)
 {
-	*String = ManagedString;
+	// The length comes from the managed string, so there's no need to scan for the terminator,
+	// and Reset keeps the current allocation whenever it's already large enough.
+	TArray<TCHAR>& CharArray = String->GetCharArray();
+	CharArray.Reset(Length + 1);
+	CharArray.Append(ManagedString, Length);
+	CharArray.Add(TEXT('\0'));
 }
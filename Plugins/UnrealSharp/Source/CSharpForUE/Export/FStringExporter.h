@@ -17,6 +17,6 @@ public:
 
 private:
 
-	static void MarshalToNativeString(FString* String, TCHAR* ManagedString);
+	static void MarshalToNativeString(FString* String, const TCHAR* ManagedString, int32 Length);
 	
 };
@@ -8,25 +8,29 @@ void UFTextExporter::ExportFunctions(FRegisterExportedFunction RegisterExportedF
 	EXPORT_FUNCTION(CreateEmptyText)
 }
 
-const TCHAR* UFTextExporter::ToString(FText* Text)
+const TCHAR* UFTextExporter::ToString(FText* Text, int32* OutLength)
 {
 	if (!Text)
 	{
+		*OutLength = 0;
 		return nullptr;
 	}
-	
-	return *Text->ToString();
+
+	// The text data caches its display string and only rebuilds it when the culture or localization changes,
+	// so hand out that string instead of copying it.
+	const FString& DisplayString = Text->ToString();
+	*OutLength = DisplayString.Len();
+	return *DisplayString;
 }
 
-void UFTextExporter::FromString(FText* Text, const char* String)
+void UFTextExporter::FromString(FText* Text, const TCHAR* String, int32 Length)
 {
 	if (!Text)
 	{
 		return;
 	}
 
-	*Text = Text->FromString(String);
-	check(true);
+	*Text = FText::FromString(FString(Length, String));
 }
 
 void UFTextExporter::FromName(FText* Text, FName Name)
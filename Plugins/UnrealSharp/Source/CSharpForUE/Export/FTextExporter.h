@@ -17,8 +17,8 @@ public:
 
 private:
 	
-	static const TCHAR* ToString(FText* Text);
-	static void FromString(FText* Text, const char* String);
+	static const TCHAR* ToString(FText* Text, int32* OutLength);
+	static void FromString(FText* Text, const TCHAR* String, int32 Length);
 	static void FromName(FText* Text, FName Name);
 	static void CreateEmptyText(FText* Text);
 	
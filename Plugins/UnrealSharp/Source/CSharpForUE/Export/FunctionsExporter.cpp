@@ -1,20 +1,42 @@
 ﻿#include "FunctionsExporter.h"
-#include "UObject/UObjectIterator.h"
+#include "UObject/UObjectHash.h"
 #include "TimerManager.h"
 
-void UFunctionsExporter::StartExportingAPI(FRegisterExportedFunction RegisterExportedFunction)
+FRegisterExportedFunction::FRegisterExportedFunction(TArray<FCSExportedFunction>& InExportedFunctions, const UClass* ExporterClass)
+	: ExportedFunctions(&InExportedFunctions)
 {
-	// CDOs hasn't been created yet. We need to look through the classes instead.
-	for (TObjectIterator<UClass> It; It; ++It)
+	TCHAR ExporterName[NAME_SIZE];
+	ExporterClass->GetFName().ToString(ExporterName);
+	ExporterHash = CSExportedFunctionId::Hash(TEXT("."), CSExportedFunctionId::Hash(ExporterName));
+}
+
+void FRegisterExportedFunction::operator()(void* FunctionPointer, const ANSICHAR* FunctionName) const
+{
+	FCSExportedFunction& ExportedFunction = ExportedFunctions->AddDefaulted_GetRef();
+	ExportedFunction.Id = CSExportedFunctionId::Hash(FunctionName, ExporterHash);
+	ExportedFunction.FunctionPointer = FunctionPointer;
+}
+
+const FCSExportedFunction* UFunctionsExporter::StartExportingAPI(int32* OutNumFunctions)
+{
+	static TArray<FCSExportedFunction> ExportedFunctions;
+	ExportedFunctions.Reset();
+	
+	// CDOs hasn't been created yet. The class hash knows every exporter, so there's no need to walk all classes.
+	TArray<UClass*> ExporterClasses;
+	GetDerivedClasses(StaticClass(), ExporterClasses);
+	
+	for (UClass* ClassObject : ExporterClasses)
 	{
-		UClass* ClassObject = *It;
-		
-		if (!ClassObject->IsChildOf(StaticClass()) || ClassObject->HasAnyClassFlags(CLASS_Abstract))
+		if (ClassObject->HasAnyClassFlags(CLASS_Abstract))
 		{
 			continue;
 		}
 		
 		UFunctionsExporter* FunctionsExporter = ClassObject->GetDefaultObject<UFunctionsExporter>();
-		FunctionsExporter->ExportFunctions(RegisterExportedFunction);
+		FunctionsExporter->ExportFunctions(FRegisterExportedFunction(ExportedFunctions, ClassObject));
 	}
+
+	*OutNumFunctions = ExportedFunctions.Num();
+	return ExportedFunctions.GetData();
 }
@@ -4,9 +4,50 @@
 #include "UObject/Object.h"
 #include "FunctionsExporter.generated.h"
 
-using FRegisterExportedFunction = void(*)(void*, const TCHAR*);
+// Layout must match ExportedFunction in InteropStructs.cs
+struct FCSExportedFunction
+{
+	uint64 Id;
+	void* FunctionPointer;
+};
+
+// The id of an exported function is the 64-bit FNV-1a hash of "ExporterName.FunctionName".
+// The managed side computes the same ids at compile time in NativeCallbacksWrapperGenerator, keep them in sync.
+namespace CSExportedFunctionId
+{
+	constexpr uint64 OffsetBasis = 0xcbf29ce484222325ull;
+	constexpr uint64 Prime = 0x100000001b3ull;
+
+	template<typename CharType>
+	constexpr uint64 Hash(const CharType* String, uint64 Seed = OffsetBasis)
+	{
+		uint64 Result = Seed;
+		for (; *String; ++String)
+		{
+			Result = (Result ^ static_cast<uint8>(*String)) * Prime;
+		}
+		return Result;
+	}
+}
+
+// Passed to UFunctionsExporter::ExportFunctions. Adds the functions of one exporter to the export table.
+class CSHARPFORUE_API FRegisterExportedFunction
+{
+public:
 
-#define EXPORT_FUNCTION(FunctionName) RegisterExportedFunction(&FunctionName, *(GetClass()->GetName() + "." + #FunctionName));
+	FRegisterExportedFunction(TArray<FCSExportedFunction>& InExportedFunctions, const UClass* ExporterClass);
+
+	void operator()(void* FunctionPointer, const ANSICHAR* FunctionName) const;
+
+private:
+
+	TArray<FCSExportedFunction>* ExportedFunctions;
+
+	// Hash of "ExporterName.", each function name continues from it.
+	uint64 ExporterHash;
+};
+
+#define EXPORT_FUNCTION(FunctionName) RegisterExportedFunction(&FunctionName, #FunctionName);
 
 UCLASS(Abstract, NotBlueprintable, NotBlueprintType, meta = (NotGeneratorValid))
 class CSHARPFORUE_API UFunctionsExporter : public UObject
@@ -18,7 +59,8 @@ public:
 	// UFunctionsExporter interface begin
 	virtual void ExportFunctions(FRegisterExportedFunction RegisterExportedFunction) { PURE_VIRTUAL() }
 	// End
-	
-	static void StartExportingAPI(FRegisterExportedFunction RegisterExportedFunction);
+
+	// Called once from C# at startup. Returns every exported function in one contiguous block.
+	static const FCSExportedFunction* StartExportingAPI(int32* OutNumFunctions);
 	
 };
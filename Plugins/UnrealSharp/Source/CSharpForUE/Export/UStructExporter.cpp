@@ -3,6 +3,7 @@
 void UUStructExporter::ExportFunctions(FRegisterExportedFunction RegisterExportedFunction)
 {
 	EXPORT_FUNCTION(InitializeStruct)
+	EXPORT_FUNCTION(ResolveTypeLayout)
 }
 
 void UUStructExporter::InitializeStruct(UStruct* Struct, void* Data)
@@ -10,3 +11,80 @@ void UUStructExporter::InitializeStruct(UStruct* Struct, void* Data)
 	check(Struct && Data);
 	Struct->InitializeStruct(Data);
 }
+
+void UUStructExporter::ResolveTypeLayout(UStruct* Struct, const UTF16CHAR* Names, int32 NumNames, FCSTypeLayoutEntry* OutEntries)
+{
+	check(Struct);
+	
+	// Parameters are requested right after their function, so remember the last one instead of searching for it again.
+	FName LastFunctionName;
+	UFunction* LastFunction = nullptr;
+	
+	for (int32 i = 0; i < NumNames; ++i)
+	{
+		// The names are packed back to back, each one null terminated.
+		const FString Name(Names);
+		while (*Names++) {}
+
+		FCSTypeLayoutEntry& Entry = OutEntries[i];
+		Entry = FCSTypeLayoutEntry();
+
+		FString FunctionName;
+		FString ParameterName;
+		
+		if (Name.EndsWith(TEXT("()")))
+		{
+			LastFunctionName = *Name.LeftChop(2);
+			LastFunction = FindFunction(Struct, LastFunctionName);
+			
+			if (LastFunction)
+			{
+				Entry.Field = LastFunction;
+				Entry.Size = LastFunction->ParmsSize;
+			}
+		}
+		else if (Name.Split(TEXT("."), &FunctionName, &ParameterName))
+		{
+			const FName FunctionFName(*FunctionName);
+			if (FunctionFName != LastFunctionName)
+			{
+				LastFunctionName = FunctionFName;
+				LastFunction = FindFunction(Struct, FunctionFName);
+			}
+
+			if (LastFunction)
+			{
+				ResolveProperty(LastFunction, *ParameterName, Entry);
+			}
+		}
+		else
+		{
+			ResolveProperty(Struct, *Name, Entry);
+		}
+	}
+}
+
+UFunction* UUStructExporter::FindFunction(UStruct* Struct, FName FunctionName)
+{
+	if (UClass* Class = Cast<UClass>(Struct))
+	{
+		return Class->FindFunctionByName(FunctionName);
+	}
+
+	// Delegate signatures are resolved on the signature function itself.
+	UFunction* Function = Cast<UFunction>(Struct);
+	return Function && Function->GetFName() == FunctionName ? Function : nullptr;
+}
+
+void UUStructExporter::ResolveProperty(UStruct* Struct, const TCHAR* PropertyName, FCSTypeLayoutEntry& OutEntry)
+{
+	FProperty* Property = FindFProperty<FProperty>(Struct, PropertyName);
+	if (!Property)
+	{
+		return;
+	}
+
+	OutEntry.Field = Property;
+	OutEntry.Offset = Property->GetOffset_ForInternal();
+	OutEntry.Size = Property->ArrayDim;
+}
@@ -4,6 +4,19 @@
 #include "FunctionsExporter.h"
 #include "UStructExporter.generated.h"
 
+// Filled in by ResolveTypeLayout, one per requested name.
+struct FCSTypeLayoutEntry
+{
+	// The FProperty or UFunction, null if it wasn't found.
+	void* Field = nullptr;
+	
+	// Offset of a property or parameter, -1 if it wasn't found.
+	int32 Offset = -1;
+
+	// ArrayDim of a property or parameter, ParmsSize of a function.
+	int32 Size = 0;
+};
+
 UCLASS()
 class CSHARPFORUE_API UUStructExporter : public UFunctionsExporter
 {
@@ -18,5 +31,12 @@ public:
 private:
 
 	static void InitializeStruct(UStruct* Struct, void* Data);
+
+	// Resolves everything a generated static constructor needs in one call, instead of one call and name search per member.
+	// Names are either "Property", "Function()" or "Function.Parameter".
+	static void ResolveTypeLayout(UStruct* Struct, const UTF16CHAR* Names, int32 NumNames, FCSTypeLayoutEntry* OutEntries);
+
+	static UFunction* FindFunction(UStruct* Struct, FName FunctionName);
+	static void ResolveProperty(UStruct* Struct, const TCHAR* PropertyName, FCSTypeLayoutEntry& OutEntry);
 	
 };
@@ -0,0 +1,33 @@
+﻿#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+#include "GlueGenerator/CSGenerator.h"
+
+// Times the full glue generation over every loaded package, as done on editor startup, without and with the
+// property translator caches, then without and with the glue manifest.
+// Run from the Session Frontend or with "Automation RunTests UnrealSharp.Performance".
+// Only files whose content changed are written, so the generated glue on disk is left as it was.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCSGlueGenerationBenchmark, "UnrealSharp.Performance.GlueGeneration", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FCSGlueGenerationBenchmark::RunTest(const FString& Parameters)
+{
+	FCSGenerator& Generator = FCSGenerator::Get();
+	FCSPropertyTranslatorManager& TranslatorManager = Generator.GetPropertyTranslatorManager();
+
+	// Both cache runs skip the manifest, so every type is built and they do the same work.
+	TranslatorManager.SetCachesEnabled(false);
+	const double UncachedTime = Generator.RegenerateAllGlue(false);
+	TranslatorManager.SetCachesEnabled(true);
+	const double CachedTime = Generator.RegenerateAllGlue(false);
+
+	AddInfo(FString::Printf(TEXT("Full glue generation: %.2f s without the translator caches, %.2f s with them"), UncachedTime, CachedTime));
+
+	// The last run left a full manifest behind, so this one only rebuilds what changed since.
+	const double ManifestTime = Generator.RegenerateAllGlue(true);
+
+	AddInfo(FString::Printf(TEXT("Full glue generation: %.2f s without the manifest, %.2f s with it"), CachedTime, ManifestTime));
+	return true;
+}
+
+#endif
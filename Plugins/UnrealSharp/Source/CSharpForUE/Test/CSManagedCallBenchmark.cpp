@@ -0,0 +1,144 @@
+﻿#include "Algo/Find.h"
+#include "Misc/AutomationTest.h"
+#include "TypeGenerator/CSClass.h"
+#include "TypeGenerator/CSFunction.h"
+#include "UObject/Script.h"
+#include "UObject/UObjectIterator.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace CSManagedCallBenchmark
+{
+	constexpr int32 ParameterCounts[] = { 0, 3, 8 };
+	constexpr int32 NumCalls = 100000;
+
+	int32 GetNumParameters(const UFunction* Function)
+	{
+		return Function->NumParms - (Function->GetReturnProperty() ? 1 : 0);
+	}
+
+	// Bytecode passing every parameter from the caller's local variables, the way a Blueprint graph calls the function.
+	TArray<uint8> MakeCallScript(const UFunction* Function)
+	{
+		TArray<uint8> Script;
+		
+		for (TFieldIterator<FProperty> It(Function); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
+		{
+			if (It->HasAnyPropertyFlags(CPF_ReturnParm))
+			{
+				continue;
+			}
+
+			const ScriptPointerType Property = static_cast<ScriptPointerType>(reinterpret_cast<UPTRINT>(*It));
+			Script.Add(EX_LocalVariable);
+			Script.Append(reinterpret_cast<const uint8*>(&Property), sizeof(Property));
+		}
+
+		Script.Add(EX_EndFunctionParms);
+		return Script;
+	}
+
+	double ToCallsPerSecond(double Seconds)
+	{
+		return NumCalls / FMath::Max(Seconds, UE_DOUBLE_SMALL_NUMBER);
+	}
+
+	// Returns the calls per second when called from Blueprint.
+	double MeasureBlueprintCalls(UObject* Object, UCSFunction* Function, const TArray<uint8>& Script, uint8* Locals, uint8* ReturnValue)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+	
+		for (int32 i = 0; i < NumCalls; ++i)
+		{
+			FFrame Stack(Object, Function, Locals);
+			Stack.Code = const_cast<uint8*>(Script.GetData());
+			Stack.CurrentNativeFunction = Function;
+			UCSClass::InvokeManagedMethod(Object, Stack, ReturnValue);
+		}
+
+		return ToCallsPerSecond(FPlatformTime::Seconds() - StartTime);
+	}
+}
+
+// Calls a C# function with 0, 3 or 8 parameters on its class default object, as a Blueprint graph would and through ProcessEvent as C++ would.
+// Functions with a native entry point are also measured through the generic InvokeManagedMethod bridge.
+// One test per loaded C# function with one of those parameter counts. Each call runs the C# function, so only run the ones whose body is safe to repeat.
+// Run from the Session Frontend or with "Automation RunTests UnrealSharp.Performance".
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FCSManagedCallBenchmark, "UnrealSharp.Performance.ManagedCall", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+void FCSManagedCallBenchmark::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (TObjectIterator<UCSClass> ClassIt; ClassIt; ++ClassIt)
+	{
+		UCSClass* Class = *ClassIt;
+		
+		if (Class->HasAnyClassFlags(CLASS_Abstract | CLASS_NewerVersionExists))
+		{
+			continue;
+		}
+
+		for (TFieldIterator<UCSFunction> FunctionIt(Class, EFieldIteratorFlags::ExcludeSuper); FunctionIt; ++FunctionIt)
+		{
+			UCSFunction* Function = *FunctionIt;
+			const int32 NumParameters = CSManagedCallBenchmark::GetNumParameters(Function);
+			
+			if (Function->GetNativeFunc() != &UCSClass::InvokeManagedMethod || !Algo::Find(CSManagedCallBenchmark::ParameterCounts, NumParameters))
+			{
+				continue;
+			}
+
+			OutBeautifiedNames.Add(FString::Printf(TEXT("%dParameters.%s.%s"), NumParameters, *Class->GetName(), *Function->GetName()));
+			OutTestCommands.Add(Function->GetPathName());
+		}
+	}
+}
+
+bool FCSManagedCallBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace CSManagedCallBenchmark;
+	
+	UCSFunction* Function = FindObject<UCSFunction>(nullptr, *Parameters);
+	if (!Function)
+	{
+		AddError(FString::Printf(TEXT("Couldn't find function %s"), *Parameters));
+		return false;
+	}
+
+	UObject* Object = Function->GetOuterUClass()->GetDefaultObject();
+	const TArray<uint8> Script = MakeCallScript(Function);
+
+	// The parameters of the function double as the local variables of the calling frame.
+	uint8* Locals = static_cast<uint8*>(FMemory::Malloc(FMath::Max<int32>(1, Function->ParmsSize), Function->GetMinAlignment()));
+	Function->InitializeStruct(Locals);
+	uint8* ReturnValue = Function->GetReturnProperty() ? Locals + Function->ReturnValueOffset : nullptr;
+
+	const double BlueprintCallsPerSecond = MeasureBlueprintCalls(Object, Function, Script, Locals, ReturnValue);
+	const double StartTime = FPlatformTime::Seconds();
+	
+	for (int32 i = 0; i < NumCalls; ++i)
+	{
+		Object->ProcessEvent(Function, Locals);
+	}
+	
+	const double ProcessEventTime = FPlatformTime::Seconds() - StartTime;
+
+	AddInfo(FString::Printf(TEXT("%s (%d parameters): %.0f calls/s from Blueprint, %.0f calls/s through ProcessEvent"),
+		*Function->GetName(), GetNumParameters(Function), BlueprintCallsPerSecond, ToCallsPerSecond(ProcessEventTime)));
+
+	// Functions with only blittable parameters are called through their own entry point, compare it with the generic bridge.
+	if (const FCSNativeEntryPoint NativeEntryPoint = Function->GetNativeEntryPoint())
+	{
+		Function->SetNativeEntryPoint(nullptr);
+		const double BridgeCallsPerSecond = MeasureBlueprintCalls(Object, Function, Script, Locals, ReturnValue);
+		Function->SetNativeEntryPoint(NativeEntryPoint);
+
+		AddInfo(FString::Printf(TEXT("%s from Blueprint: %.0f calls/s through the native entry point, %.0f calls/s through InvokeManagedMethod"),
+			*Function->GetName(), BlueprintCallsPerSecond, BridgeCallsPerSecond));
+	}
+
+	Function->DestroyStruct(Locals);
+	FMemory::Free(Locals);
+	return true;
+}
+
+#endif
@@ -0,0 +1,54 @@
+﻿#include "CSManager.h"
+#include "Misc/AutomationTest.h"
+#include "TypeGenerator/CSClass.h"
+#include "TypeGenerator/CSFunction.h"
+#include "TypeGenerator/Register/TypeInfo/CSClassInfo.h"
+#include "UObject/UObjectIterator.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Every C# function has to resolve from the weaver-generated method table, without falling back to a reflection lookup.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCSManagedMethodTableTest, "UnrealSharp.Interop.ManagedMethodTable", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FCSManagedMethodTableTest::RunTest(const FString& Parameters)
+{
+	int32 NumFunctions = 0;
+	
+	for (TObjectIterator<UCSClass> ClassIt; ClassIt; ++ClassIt)
+	{
+		UCSClass* Class = *ClassIt;
+		
+		if (Class->HasAnyClassFlags(CLASS_NewerVersionExists))
+		{
+			continue;
+		}
+
+		uint8* TypeHandle = Class->GetClassInfo()->TypeHandle;
+		
+		for (TFieldIterator<UCSFunction> FunctionIt(Class, EFieldIteratorFlags::ExcludeSuper); FunctionIt; ++FunctionIt)
+		{
+			UCSFunction* Function = *FunctionIt;
+			const FString FunctionPath = Function->GetPathName();
+			
+			const FName InvokerName(*FString::Printf(TEXT("Invoke_%s"), *Function->GetName()));
+			TestNotNull(*FString::Printf(TEXT("%s in method table"), *FunctionPath), FCSManager::Get().FindManagedMethod(TypeHandle, InvokerName));
+
+			if (Function->GetNativeEntryPoint())
+			{
+				const FName EntryPointName(*FString::Printf(TEXT("InvokeUnmanaged_%s"), *Function->GetName()));
+				TestNotNull(*FString::Printf(TEXT("%s native entry point in method table"), *FunctionPath), FCSManager::Get().FindManagedMethod(TypeHandle, EntryPointName));
+			}
+
+			++NumFunctions;
+		}
+	}
+
+	if (NumFunctions == 0)
+	{
+		AddWarning(TEXT("No C# functions are loaded, nothing was checked."));
+	}
+	
+	return true;
+}
+
+#endif
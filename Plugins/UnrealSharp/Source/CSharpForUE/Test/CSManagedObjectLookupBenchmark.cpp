@@ -0,0 +1,120 @@
+﻿#include "CSManagedGCHandle.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeRWLock.h"
+#include "UObject/ObjectRedirector.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace CSManagedObjectLookupBenchmark
+{
+	constexpr int32 ObjectCounts[] = { 10000, 100000, 1000000 };
+	constexpr int32 NumLookups = 1000000;
+
+	// The handles are never passed to C#, only the lookup is measured.
+	FGCHandle MakeFakeHandle(int32 Index)
+	{
+		GCHandleIntPtr IntPtr;
+		IntPtr.IntPtr = reinterpret_cast<uint8*>(static_cast<UPTRINT>(Index + 1) * sizeof(void*));
+		return FGCHandle(IntPtr);
+	}
+
+	double ToNanosecondsPerLookup(double Seconds)
+	{
+		return Seconds * 1e9 / NumLookups;
+	}
+}
+
+// Compares the lookup FCSManager::FindManagedObject used to do, a TMap keyed by the object, with the table it uses now,
+// indexed by the object's GUObjectArray index under a read lock. Both are filled with the same objects and looked up in the same random order.
+// Run from the Session Frontend or with "Automation RunTests UnrealSharp.Performance".
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCSManagedObjectLookupBenchmark, "UnrealSharp.Performance.ManagedObjectLookup", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FCSManagedObjectLookupBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace CSManagedObjectLookupBenchmark;
+	
+	for (const int32 NumObjects : ObjectCounts)
+	{
+		// Garbage collection doesn't run during the test, so the objects don't need to be rooted.
+		TArray<UObject*> Objects;
+		Objects.Reserve(NumObjects);
+		
+		TMap<UObject*, FGCHandle> HandleMap;
+		HandleMap.Reserve(NumObjects);
+		
+		TArray<FGCHandle> HandleTable;
+		FRWLock HandleTableLock;
+		
+		for (int32 i = 0; i < NumObjects; ++i)
+		{
+			UObject* Object = NewObject<UObjectRedirector>(GetTransientPackage());
+			const FGCHandle Handle = MakeFakeHandle(i);
+			
+			HandleMap.Add(Object, Handle);
+
+			const int32 ObjectIndex = GUObjectArray.ObjectToIndex(Object);
+			if (!HandleTable.IsValidIndex(ObjectIndex))
+			{
+				HandleTable.SetNum(FMath::Max(ObjectIndex + 1, GUObjectArray.GetObjectArrayNum()));
+			}
+			HandleTable[ObjectIndex] = Handle;
+			
+			Objects.Add(Object);
+		}
+
+		FRandomStream Random(NumObjects);
+		TArray<UObject*> LookupOrder;
+		LookupOrder.SetNumUninitialized(NumLookups);
+		
+		for (UObject*& Object : LookupOrder)
+		{
+			Object = Objects[Random.RandHelper(NumObjects)];
+		}
+
+		UPTRINT MapSum = 0;
+		double StartTime = FPlatformTime::Seconds();
+		
+		for (UObject* Object : LookupOrder)
+		{
+			if (const FGCHandle* Handle = HandleMap.Find(Object))
+			{
+				MapSum += reinterpret_cast<UPTRINT>(Handle->GetIntPtr());
+			}
+		}
+		
+		const double MapTime = FPlatformTime::Seconds() - StartTime;
+
+		UPTRINT TableSum = 0;
+		StartTime = FPlatformTime::Seconds();
+		
+		for (UObject* Object : LookupOrder)
+		{
+			FReadScopeLock ReadLock(HandleTableLock);
+			const int32 ObjectIndex = GUObjectArray.ObjectToIndex(Object);
+			
+			if (HandleTable.IsValidIndex(ObjectIndex))
+			{
+				TableSum += reinterpret_cast<UPTRINT>(HandleTable[ObjectIndex].GetIntPtr());
+			}
+		}
+		
+		const double TableTime = FPlatformTime::Seconds() - StartTime;
+
+		// Also keeps the lookups from being optimized away.
+		TestEqual(*FString::Printf(TEXT("Handles found for %d objects"), NumObjects), TableSum, MapSum);
+		
+		AddInfo(FString::Printf(TEXT("%d objects, %d lookups: %.1f ns per lookup with TMap, %.1f ns with the index table"),
+			NumObjects, NumLookups, ToNanosecondsPerLookup(MapTime), ToNanosecondsPerLookup(TableTime)));
+
+		for (UObject* Object : Objects)
+		{
+			Object->MarkAsGarbage();
+		}
+	}
+	
+	return true;
+}
+
+#endif
@@ -0,0 +1,104 @@
+﻿#include "CSManager.h"
+#include "Components/SceneComponent.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "Tasks/Task.h"
+#include "UObject/Package.h"
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace CSManagedObjectLookupStressTest
+{
+	constexpr int32 NumObjects = 1000;
+	constexpr int32 NumLookupsPerWorker = 100000;
+	constexpr int32 NumObjectsCreatedDuringLookups = 10000;
+
+	USceneComponent* NewRootedObject()
+	{
+		USceneComponent* Object = NewObject<USceneComponent>(GetTransientPackage());
+		Object->AddToRoot();
+		return Object;
+	}
+
+	void ReleaseObjects(TArrayView<USceneComponent*> Objects)
+	{
+		for (USceneComponent* Object : Objects)
+		{
+			Object->RemoveFromRoot();
+			Object->MarkAsGarbage();
+		}
+	}
+}
+
+// Every worker thread looks up managed objects while the game thread creates new ones, growing the handle table under them.
+// Workers have to get the managed object the game thread created, or a miss for objects C# hasn't seen, never one of their own.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCSManagedObjectLookupStressTest, "UnrealSharp.Interop.ManagedObjectLookupStress", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FCSManagedObjectLookupStressTest::RunTest(const FString& Parameters)
+{
+	using namespace CSManagedObjectLookupStressTest;
+	
+	FCSManager& Manager = FCSManager::Get();
+
+	TArray<USceneComponent*> SeenObjects;
+	TArray<FGCHandle> SeenHandles;
+	TArray<USceneComponent*> UnseenObjects;
+	
+	for (int32 i = 0; i < NumObjects; ++i)
+	{
+		SeenObjects.Add(NewRootedObject());
+		SeenHandles.Add(Manager.FindManagedObject(SeenObjects.Last()));
+		UnseenObjects.Add(NewRootedObject());
+	}
+
+	std::atomic<int32> NumWrongHandles = 0;
+	std::atomic<int32> NumCreatedOffGameThread = 0;
+	
+	const int32 NumWorkers = FMath::Max(FTaskGraphInterface::Get().GetNumWorkerThreads(), 1);
+	TArray<UE::Tasks::FTask> Workers;
+	
+	for (int32 WorkerIndex = 0; WorkerIndex < NumWorkers; ++WorkerIndex)
+	{
+		Workers.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [&, WorkerIndex]
+		{
+			FRandomStream Random(WorkerIndex);
+			
+			for (int32 i = 0; i < NumLookupsPerWorker; ++i)
+			{
+				const int32 Index = Random.RandHelper(NumObjects);
+				
+				// Wrappers of native classes are weak, so C# may have collected one, which reads as a miss.
+				const FGCHandle Handle = Manager.FindManagedObject(SeenObjects[Index]);
+				if (!Handle.IsNull() && Handle.GetHandle() != SeenHandles[Index].GetHandle())
+				{
+					++NumWrongHandles;
+				}
+
+				if (!Manager.FindManagedObject(UnseenObjects[Index]).IsNull())
+				{
+					++NumCreatedOffGameThread;
+				}
+			}
+		}));
+	}
+
+	TArray<USceneComponent*> CreatedObjects;
+	for (int32 i = 0; i < NumObjectsCreatedDuringLookups; ++i)
+	{
+		CreatedObjects.Add(NewRootedObject());
+		Manager.FindManagedObject(CreatedObjects.Last());
+	}
+
+	UE::Tasks::Wait(Workers);
+
+	TestEqual(TEXT("Lookups that returned another managed object"), NumWrongHandles.load(), 0);
+	TestEqual(TEXT("Managed objects created off the game thread"), NumCreatedOffGameThread.load(), 0);
+
+	ReleaseObjects(SeenObjects);
+	ReleaseObjects(UnseenObjects);
+	ReleaseObjects(CreatedObjects);
+	return true;
+}
+
+#endif
@@ -0,0 +1,64 @@
+﻿#include "CSManager.h"
+#include "Components/SceneComponent.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace CSManagedObjectUnloadBenchmark
+{
+	constexpr int32 NumObjects = 50000;
+
+	// Creates the objects, optionally with their managed objects, then times the garbage collection that deletes them, in milliseconds.
+	// The handles of deleted objects are disposed in one batch right after the collection, so that's included.
+	double MeasureUnload(bool bWithManagedObjects)
+	{
+		FCSManager& Manager = FCSManager::Get();
+		
+		TArray<USceneComponent*> Objects;
+		Objects.Reserve(NumObjects);
+		
+		for (int32 i = 0; i < NumObjects; ++i)
+		{
+			USceneComponent* Object = NewObject<USceneComponent>(GetTransientPackage());
+			
+			if (bWithManagedObjects)
+			{
+				Manager.FindManagedObject(Object);
+			}
+			
+			Objects.Add(Object);
+		}
+
+		for (USceneComponent* Object : Objects)
+		{
+			Object->MarkAsGarbage();
+		}
+
+		const double StartTime = FPlatformTime::Seconds();
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+		return (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	}
+}
+
+// Deletes 50k objects with and without managed objects in one garbage collection, like a level unload does.
+// The difference is the cost of releasing the managed objects.
+// Run from the Session Frontend or with "Automation RunTests UnrealSharp.Performance".
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCSManagedObjectUnloadBenchmark, "UnrealSharp.Performance.ManagedObjectUnload", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FCSManagedObjectUnloadBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace CSManagedObjectUnloadBenchmark;
+	
+	// Collect anything left over first, so it isn't counted in either run.
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+	
+	const double NativeOnlyTime = MeasureUnload(false);
+	const double ManagedTime = MeasureUnload(true);
+
+	AddInfo(FString::Printf(TEXT("Unloading %d objects: %.2f ms without managed objects, %.2f ms with them"), NumObjects, NativeOnlyTime, ManagedTime));
+	return true;
+}
+
+#endif
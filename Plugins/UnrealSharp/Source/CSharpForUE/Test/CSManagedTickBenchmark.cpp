@@ -0,0 +1,141 @@
+﻿#include "CSDeveloperSettings.h"
+#include "CSManagedTickSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/WorldSettings.h"
+#include "Misc/AutomationTest.h"
+#include "TypeGenerator/CSClass.h"
+#include "TypeGenerator/CSFunction.h"
+#include "TypeGenerator/Register/CSGeneratedClassBuilder.h"
+#include "UObject/UObjectIterator.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace CSManagedTickBenchmark
+{
+	constexpr int32 NumActors = 10000;
+	constexpr int32 NumWarmupFrames = 10;
+	constexpr int32 NumMeasuredFrames = 300;
+	constexpr float FrameDeltaTime = 1.0f / 60.0f;
+
+	// Spawns the actors in a new game world and measures the average time of a world tick, in milliseconds.
+	// Fails if batching is enabled but the subsystem didn't take over the tick of every actor.
+	bool MeasureTick(FAutomationTestBase& Test, UClass* ActorClass, bool bBatchManagedTicks, double& OutAverageTickTime)
+	{
+		UCSDeveloperSettings* Settings = GetMutableDefault<UCSDeveloperSettings>();
+		const bool bPreviousBatchManagedTicks = Settings->bBatchManagedTicks;
+		
+		// The subsystem is only created for worlds made while batching is enabled.
+		Settings->bBatchManagedTicks = bBatchManagedTicks;
+
+		// Game modes and world subsystems expect a world owned by a game instance.
+		UGameInstance* GameInstance = NewObject<UGameInstance>(GEngine);
+		GameInstance->InitializeStandalone();
+		UWorld* World = GameInstance->GetWorld();
+
+		const FURL URL;
+		World->InitializeActorsForPlay(URL);
+		World->SetGameMode(URL);
+		World->BeginPlay();
+
+		int32 NumSpawnedActors = 0;
+		for (int32 i = 0; i < NumActors; ++i)
+		{
+			if (World->SpawnActor(ActorClass))
+			{
+				++NumSpawnedActors;
+			}
+		}
+
+		// The subsystem takes over spawned actors on the next tick, once they have begun play.
+		for (int32 i = 0; i < NumWarmupFrames; ++i)
+		{
+			World->Tick(LEVELTICK_All, FrameDeltaTime);
+		}
+
+		bool bTookOverTicks = Test.TestEqual(TEXT("Number of spawned actors"), NumSpawnedActors, NumActors);
+		if (bTookOverTicks && bBatchManagedTicks)
+		{
+			const UCSManagedTickSubsystem* Subsystem = World->GetSubsystem<UCSManagedTickSubsystem>();
+			const int32 NumTickers = Subsystem ? Subsystem->GetNumTickers() : 0;
+			bTookOverTicks = Test.TestEqual(TEXT("Number of actors ticked by UCSManagedTickSubsystem"), NumTickers, NumActors);
+		}
+
+		if (bTookOverTicks)
+		{
+			const double StartTime = FPlatformTime::Seconds();
+
+			for (int32 i = 0; i < NumMeasuredFrames; ++i)
+			{
+				World->Tick(LEVELTICK_All, FrameDeltaTime);
+			}
+
+			OutAverageTickTime = (FPlatformTime::Seconds() - StartTime) * 1000.0 / NumMeasuredFrames;
+		}
+
+		GameInstance->Shutdown();
+		World->DestroyWorld(false);
+		GEngine->DestroyWorldContext(World);
+		Settings->bBatchManagedTicks = bPreviousBatchManagedTicks;
+		
+		return bTookOverTicks;
+	}
+}
+
+// Ticks 10k instances of a C# actor with and without UCSDeveloperSettings::bBatchManagedTicks.
+// One test per loaded C# actor class that overrides ReceiveTick, run from the Session Frontend or with "Automation RunTests UnrealSharp.Performance".
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FCSManagedTickBenchmark, "UnrealSharp.Performance.ManagedTick", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+void FCSManagedTickBenchmark::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (TObjectIterator<UCSClass> ClassIt; ClassIt; ++ClassIt)
+	{
+		UCSClass* Class = *ClassIt;
+		
+		if (!Class->IsChildOf<AActor>() || Class->HasAnyClassFlags(CLASS_Abstract | CLASS_NewerVersionExists))
+		{
+			continue;
+		}
+
+		if (FCSGeneratedClassBuilder::GetFirstNativeClass(Class) != AActor::StaticClass() || !Cast<UCSFunction>(Class->FindFunctionByName(TEXT("ReceiveTick"))))
+		{
+			continue;
+		}
+
+		if (!Class->GetDefaultObject<AActor>()->PrimaryActorTick.bCanEverTick)
+		{
+			continue;
+		}
+
+		OutBeautifiedNames.Add(Class->GetName());
+		OutTestCommands.Add(Class->GetPathName());
+	}
+}
+
+bool FCSManagedTickBenchmark::RunTest(const FString& Parameters)
+{
+	UClass* ActorClass = FindObject<UClass>(nullptr, *Parameters);
+	if (!ActorClass)
+	{
+		AddError(FString::Printf(TEXT("Couldn't find class %s"), *Parameters));
+		return false;
+	}
+
+	double UnbatchedTickTime = 0.0;
+	double BatchedTickTime = 0.0;
+	
+	if (!CSManagedTickBenchmark::MeasureTick(*this, ActorClass, false, UnbatchedTickTime)
+		|| !CSManagedTickBenchmark::MeasureTick(*this, ActorClass, true, BatchedTickTime))
+	{
+		return false;
+	}
+
+	AddInfo(FString::Printf(TEXT("%d x %s, average world tick: %.3f ms unbatched, %.3f ms batched"),
+		CSManagedTickBenchmark::NumActors, *ActorClass->GetName(), UnbatchedTickTime, BatchedTickTime));
+	
+	return true;
+}
+
+#endif
@@ -0,0 +1,105 @@
+﻿#include "Components/TextBlock.h"
+#include "Export/FTextExporter.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/StringBuilder.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace CSTextBlockBenchmark
+{
+	constexpr int32 NumTextBlocks = 1000;
+	constexpr int32 NumWarmupFrames = 10;
+	constexpr int32 NumMeasuredFrames = 300;
+
+	using FFromString = void(*)(FText*, const TCHAR*, int32);
+	using FToString = const TCHAR*(*)(FText*, int32*);
+
+	// Looks the function up in the export table C# binds to, so it's called through the same pointer.
+	void* FindExportedFunction(UClass* ExporterClass, const ANSICHAR* FunctionName)
+	{
+		TArray<FCSExportedFunction> ExportedFunctions;
+		ExporterClass->GetDefaultObject<UFunctionsExporter>()->ExportFunctions(FRegisterExportedFunction(ExportedFunctions, ExporterClass));
+
+		const uint64 ExporterHash = CSExportedFunctionId::Hash(TEXT("."), CSExportedFunctionId::Hash(*ExporterClass->GetName()));
+		const uint64 FunctionId = CSExportedFunctionId::Hash(FunctionName, ExporterHash);
+		
+		const FCSExportedFunction* Found = ExportedFunctions.FindByPredicate([FunctionId](const FCSExportedFunction& ExportedFunction)
+		{
+			return ExportedFunction.Id == FunctionId;
+		});
+		
+		return Found ? Found->FunctionPointer : nullptr;
+	}
+}
+
+// Updates 1,000 text blocks every frame the way C# does: the text is built from a string through UFTextExporter::FromString,
+// set on the block, and read back through UFTextExporter::ToString. The blocks have their Slate widgets, so setting the text updates them too.
+// Run from the Session Frontend or with "Automation RunTests UnrealSharp.Performance".
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCSTextBlockBenchmark, "UnrealSharp.Performance.TextBlockUpdate", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FCSTextBlockBenchmark::RunTest(const FString& Parameters)
+{
+	using namespace CSTextBlockBenchmark;
+	
+	const FFromString FromString = static_cast<FFromString>(FindExportedFunction(UFTextExporter::StaticClass(), "FromString"));
+	const FToString ToString = static_cast<FToString>(FindExportedFunction(UFTextExporter::StaticClass(), "ToString"));
+	
+	if (!TestNotNull(TEXT("UFTextExporter::FromString"), FromString) || !TestNotNull(TEXT("UFTextExporter::ToString"), ToString))
+	{
+		return false;
+	}
+
+	TArray<UTextBlock*> TextBlocks;
+	for (int32 i = 0; i < NumTextBlocks; ++i)
+	{
+		UTextBlock* TextBlock = NewObject<UTextBlock>(GetTransientPackage());
+		TextBlock->AddToRoot();
+		TextBlock->TakeWidget();
+		TextBlocks.Add(TextBlock);
+	}
+
+	int32 NumCharactersRead = 0;
+	double StartTime = 0.0;
+	
+	for (int32 Frame = 0; Frame < NumWarmupFrames + NumMeasuredFrames; ++Frame)
+	{
+		if (Frame == NumWarmupFrames)
+		{
+			StartTime = FPlatformTime::Seconds();
+		}
+		
+		for (int32 i = 0; i < NumTextBlocks; ++i)
+		{
+			TStringBuilder<64> Builder;
+			Builder.Appendf(TEXT("Score: %d"), Frame * NumTextBlocks + i);
+
+			FText Text;
+			FromString(&Text, Builder.GetData(), Builder.Len());
+			TextBlocks[i]->SetText(Text);
+
+			FText ReadText = TextBlocks[i]->GetText();
+			int32 Length = 0;
+			ToString(&ReadText, &Length);
+			NumCharactersRead += Length;
+		}
+	}
+	
+	const double AverageFrameTime = (FPlatformTime::Seconds() - StartTime) * 1000.0 / NumMeasuredFrames;
+
+	// Also keeps the reads from being optimized away.
+	TestTrue(TEXT("Text was read back"), NumCharactersRead > 0);
+	
+	AddInfo(FString::Printf(TEXT("%d text blocks, average update: %.3f ms per frame"), NumTextBlocks, AverageFrameTime));
+
+	for (UTextBlock* TextBlock : TextBlocks)
+	{
+		TextBlock->ReleaseSlateResources(true);
+		TextBlock->RemoveFromRoot();
+		TextBlock->MarkAsGarbage();
+	}
+	
+	return true;
+}
+
+#endif
@@ -19,58 +19,65 @@ void UCSClass::InvokeManagedMethod(UObject* ObjectToInvokeOn, FFrame& Stack, RES
 		return;
 	}
 	
+	const FCSFunctionInvocationPlan& InvocationPlan = Function->GetInvocationPlan();
 	FOutParmRec* OutParameters = nullptr;
-	FOutParmRec** LastOut = &OutParameters;
 	uint8* ArgumentBuffer = Stack.Locals;
 	
 	if (Stack.Code)
 	{
 		int LocalStructSize = Function->GetStructureSize();
-		TArrayView<uint8> ArgumentData((uint8*)FMemory_Alloca(FMath::Max<int32>(1, LocalStructSize)), LocalStructSize);
-		ArgumentBuffer = ArgumentData.GetData();
-		Function->InitializeStruct(ArgumentBuffer);
-	
-		for (TFieldIterator<FProperty> ParamIt(Function, EFieldIteratorFlags::ExcludeSuper); ParamIt; ++ParamIt)
-		{
-			FProperty* FunctionParameter = *ParamIt;
+		ArgumentBuffer = static_cast<uint8*>(FMemory_Alloca(FMath::Max<int32>(1, LocalStructSize)));
 
-			if (FunctionParameter->HasAnyPropertyFlags(CPF_ReturnParm))
-			{
-				continue;
-			}
+		if (InvocationPlan.bHasTrivialFrame)
+		{
+			FMemory::Memzero(ArgumentBuffer, LocalStructSize);
+		}
+		else
+		{
+			Function->InitializeStruct(ArgumentBuffer);
+		}
 
+		// Allocate the whole output parameter chain up front and link it as we go.
+		FOutParmRec* NextOut = nullptr;
+		if (InvocationPlan.NumOutParameters)
+		{
+			OutParameters = static_cast<FOutParmRec*>(FMemory_Alloca(InvocationPlan.NumOutParameters * sizeof(FOutParmRec)));
+			NextOut = OutParameters;
+		}
+	
+		for (const FCSFunctionParameter& Parameter : InvocationPlan.Parameters)
+		{
+			FProperty* FunctionParameter = Parameter.Property;
+			
 			Stack.MostRecentPropertyAddress = nullptr;
 			Stack.MostRecentPropertyContainer = nullptr;
-			uint8* LocalValue = FunctionParameter->ContainerPtrToValuePtr<uint8>(ArgumentData.GetData());
+			uint8* LocalValue = ArgumentBuffer + Parameter.Offset;
 			Stack.StepCompiledIn(LocalValue, FunctionParameter->GetClass());
 		
 			uint8* ValueAddress = LocalValue;
-			if (FunctionParameter->HasAnyPropertyFlags(CPF_OutParm) && Stack.MostRecentPropertyAddress)
+			if (Parameter.bIsReference && Stack.MostRecentPropertyAddress)
 			{
 				ValueAddress = Stack.MostRecentPropertyAddress;
 			}
 
 			// Add any output parameters to the output params chain
-			if (FCSPropertyFactory::IsOutParameter(FunctionParameter))
+			if (Parameter.bIsOutParameter)
 			{
-				FOutParmRec* Out = static_cast<FOutParmRec*>(FMemory_Alloca(sizeof(FOutParmRec)));
-				Out->Property = FunctionParameter;
-				Out->PropAddr = ValueAddress;
-				Out->NextOutParm = nullptr;
+				NextOut->Property = FunctionParameter;
+				NextOut->PropAddr = ValueAddress;
+				NextOut->NextOutParm = NextOut + 1;
+				++NextOut;
+			}
 
-				// Link it to the end of the list
-				if (*LastOut)
-				{
-					(*LastOut)->NextOutParm = Out;
-					LastOut = &(*LastOut)->NextOutParm;
-				}
-				else
-				{
-					*LastOut = Out;
-				}
+			if (ValueAddress != LocalValue)
+			{
+				FunctionParameter->CopyCompleteValue(LocalValue, ValueAddress);
 			}
-			
-			FunctionParameter->CopyCompleteValue(ArgumentData.GetData() + FunctionParameter->GetOffset_ForInternal(), ValueAddress);
+		}
+
+		if (OutParameters)
+		{
+			OutParameters[InvocationPlan.NumOutParameters - 1].NextOutParm = nullptr;
 		}
 	}
 	
@@ -82,7 +89,7 @@ void UCSClass::InvokeManagedMethod(UObject* ObjectToInvokeOn, FFrame& Stack, RES
 	ProcessOutParameters(OutParameters, ArgumentBuffer);
 
 	// Don't free up memory if we're calling this from C++/C#, only Blueprints.
-	if (Stack.Code)
+	if (Stack.Code && !InvocationPlan.bHasTrivialFrame)
 	{
 		Function->DestroyStruct(ArgumentBuffer);
 	}
@@ -106,25 +113,41 @@ bool UCSClass::InvokeManagedEvent(UObject* ObjectToInvokeOn, FFrame& Stack, cons
 	
 	const FGCHandle ManagedObjectHandle = FCSManager::Get().FindManagedObject(ObjectToInvokeOn);
 	FString ExceptionMessage;
+	int32 Result;
+
+	// Functions with only blittable parameters have their own unmanaged entry point, so skip the generic bridge.
+	if (const FCSNativeEntryPoint NativeEntryPoint = Function->GetNativeEntryPoint())
+	{
+		Result = NativeEntryPoint(ManagedObjectHandle.GetHandle(), ArgumentBuffer, RESULT_PARAM, &ExceptionMessage);
+	}
+	else
+	{
+		Result = FCSManagedCallbacks::ManagedCallbacks.InvokeManagedMethod(ManagedObjectHandle.GetHandle(),
+			Function->GetManagedMethod(),
+			ArgumentBuffer,
+			RESULT_PARAM,
+			&ExceptionMessage);
+	}
 	
-	bool bSuccess = FCSManagedCallbacks::ManagedCallbacks.InvokeManagedMethod(ManagedObjectHandle.GetHandle(),
-		Function->GetManagedMethod(),
-		ArgumentBuffer,
-		RESULT_PARAM,
-		&ExceptionMessage) == 0;
+	bool bSuccess = Result == 0;
 	
 	if (!bSuccess)
 	{
-		const UCSDeveloperSettings* Settings = GetDefault<UCSDeveloperSettings>();
-		EBlueprintExceptionType::Type ExceptionType = Settings->bCrashOnException ? EBlueprintExceptionType::FatalError : EBlueprintExceptionType::NonFatalError;
-		
-		const FBlueprintExceptionInfo ExceptionInfo(ExceptionType, FText::FromString(ExceptionMessage));
-		FBlueprintCoreDelegates::ThrowScriptException(ObjectToInvokeOn, Stack, ExceptionInfo);
+		ThrowManagedException(ObjectToInvokeOn, Stack, ExceptionMessage);
 	}
 	
 	return bSuccess;
 }
 
+void UCSClass::ThrowManagedException(UObject* ObjectToInvokeOn, FFrame& Stack, const FString& ExceptionMessage)
+{
+	const UCSDeveloperSettings* Settings = GetDefault<UCSDeveloperSettings>();
+	EBlueprintExceptionType::Type ExceptionType = Settings->bCrashOnException ? EBlueprintExceptionType::FatalError : EBlueprintExceptionType::NonFatalError;
+	
+	const FBlueprintExceptionInfo ExceptionInfo(ExceptionType, FText::FromString(ExceptionMessage));
+	FBlueprintCoreDelegates::ThrowScriptException(ObjectToInvokeOn, Stack, ExceptionInfo);
+}
+
 TSharedRef<FCSharpClassInfo> UCSClass::GetClassInfo() const
 {
 	return ClassMetaData.ToSharedRef();
@@ -21,6 +21,7 @@ public:
 	static void InvokeManagedMethod(UObject* ObjectToInvokeOn, FFrame& Stack, RESULT_DECL);
 	static void ProcessOutParameters(FOutParmRec* OutParameters, uint8* ArgumentBuffer);
 	static bool InvokeManagedEvent(UObject* ObjectToInvokeOn, FFrame& Stack, const UCSFunction* Function, uint8* ArgumentBuffer, RESULT_DECL);
+	static void ThrowManagedException(UObject* ObjectToInvokeOn, FFrame& Stack, const FString& ExceptionMessage);
 	bool bCanTick = true;
 
 	TSharedRef<FCSharpClassInfo> GetClassInfo() const;
@@ -1,6 +1,40 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "CSFunction.h"
+#include "Factories/CSPropertyFactory.h"
+
+void UCSFunction::Link(FArchive& Ar, bool bRelinkExistingProperties)
+{
+	Super::Link(Ar, bRelinkExistingProperties);
+
+	InvocationPlan = FCSFunctionInvocationPlan();
+	
+	for (TFieldIterator<FProperty> ParamIt(this, EFieldIteratorFlags::ExcludeSuper); ParamIt; ++ParamIt)
+	{
+		FProperty* FunctionParameter = *ParamIt;
+
+		if (!FunctionParameter->HasAllPropertyFlags(CPF_ZeroConstructor | CPF_NoDestructor))
+		{
+			InvocationPlan.bHasTrivialFrame = false;
+		}
+
+		if (FunctionParameter->HasAnyPropertyFlags(CPF_ReturnParm))
+		{
+			continue;
+		}
+
+		FCSFunctionParameter& Parameter = InvocationPlan.Parameters.AddDefaulted_GetRef();
+		Parameter.Property = FunctionParameter;
+		Parameter.Offset = FunctionParameter->GetOffset_ForUFunction();
+		Parameter.bIsReference = FunctionParameter->HasAnyPropertyFlags(CPF_OutParm);
+		Parameter.bIsOutParameter = FCSPropertyFactory::IsOutParameter(FunctionParameter);
+
+		if (Parameter.bIsOutParameter)
+		{
+			++InvocationPlan.NumOutParameters;
+		}
+	}
+}
 
 void UCSFunction::SetManagedMethod(void* InManagedMethod)
 {
@@ -11,3 +45,8 @@ void* UCSFunction::GetManagedMethod() const
 {
 	return ManagedMethod;
 }
+
+void UCSFunction::SetNativeEntryPoint(FCSNativeEntryPoint InNativeEntryPoint)
+{
+	NativeEntryPoint = InNativeEntryPoint;
+}
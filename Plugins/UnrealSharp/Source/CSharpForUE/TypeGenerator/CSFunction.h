@@ -5,18 +5,54 @@
 #include "CoreMinimal.h"
 #include "CSFunction.generated.h"
 
+struct GCHandleIntPtr;
+
+// Weaver-generated [UnmanagedCallersOnly] InvokeUnmanaged_ method, emitted for functions with only blittable parameters.
+using FCSNativeEntryPoint = int(__stdcall*)(GCHandleIntPtr, void*, void*, void*);
+
+struct FCSFunctionParameter
+{
+	FProperty* Property = nullptr;
+	int32 Offset = 0;
+	bool bIsReference = false;
+	bool bIsOutParameter = false;
+};
+
+// Precomputed when the function is linked, so invoking it from Blueprint doesn't need to walk its properties.
+struct FCSFunctionInvocationPlan
+{
+	// Parameters in the order they're pushed on the Blueprint stack, return value excluded.
+	TArray<FCSFunctionParameter> Parameters;
+	int32 NumOutParameters = 0;
+
+	// All parameters are zero constructible and need no destructor, so the frame can be zeroed instead of initialized and destroyed.
+	bool bHasTrivialFrame = true;
+};
+
 UCLASS()
 class CSHARPFORUE_API UCSFunction : public UFunction
 {
 	GENERATED_BODY()
 
 public:
+
+	// UStruct interface
+	virtual void Link(FArchive& Ar, bool bRelinkExistingProperties) override;
+	// End of UStruct interface
 	
 	void SetManagedMethod(void* InManagedMethod);
 	void* GetManagedMethod() const;
 
+	void SetNativeEntryPoint(FCSNativeEntryPoint InNativeEntryPoint);
+	FCSNativeEntryPoint GetNativeEntryPoint() const { return NativeEntryPoint; }
+
+	const FCSFunctionInvocationPlan& GetInvocationPlan() const { return InvocationPlan; }
+
 private:
 
 	void* ManagedMethod;
+	FCSNativeEntryPoint NativeEntryPoint = nullptr;
+
+	FCSFunctionInvocationPlan InvocationPlan;
 	
 };
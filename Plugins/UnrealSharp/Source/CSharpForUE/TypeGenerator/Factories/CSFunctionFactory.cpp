@@ -10,6 +10,11 @@ UCSFunction* FCSFunctionFactory::CreateFunction(UClass* Outer, const FName& Name
 	NewFunction->FunctionFlags = FunctionMetaData.FunctionFlags | FunctionFlags;
 	NewFunction->SetSuperStruct(ParentFunction);
 	NewFunction->SetManagedMethod(FCSGeneratedClassBuilder::TryGetManagedFunction(Outer, Name));
+
+	if (FunctionMetaData.HasNativeEntryPoint)
+	{
+		NewFunction->SetNativeEntryPoint(static_cast<FCSNativeEntryPoint>(FCSGeneratedClassBuilder::TryGetNativeEntryPoint(Outer, Name)));
+	}
 	
 	FCSMetaDataUtils::ApplyMetaData(FunctionMetaData.MetaData, NewFunction);
 	FinalizeFunctionSetup(Outer, NewFunction);
@@ -1,5 +1,6 @@
 ﻿#include "CSMetaDataFactory.h"
 #include "Dom/JsonObject.h"
+#include "TypeGenerator/Register/CSMetaDataReader.h"
 #include "TypeGenerator/Register/MetaData/CSArrayPropertyMetaData.h"
 #include "TypeGenerator/Register/MetaData/CSClassPropertyMetaData.h"
 #include "TypeGenerator/Register/MetaData/CSDefaultComponentMetaData.h"
@@ -40,21 +41,37 @@ void CSMetaDataFactory::Initialize()
 
 TSharedPtr<FCSUnrealType> CSMetaDataFactory::Create(const TSharedPtr<FJsonObject>& PropertyMetaData)
 {
-	Initialize();
-	
 	const TSharedPtr<FJsonObject>& PropertyTypeObject = PropertyMetaData->GetObjectField(TEXT("PropertyDataType"));
 	ECSPropertyType PropertyType = static_cast<ECSPropertyType>(PropertyTypeObject->GetIntegerField(TEXT("PropertyType")));
 	
-	TSharedPtr<FCSUnrealType> MetaData;
-	if (TFunction<TSharedPtr<FCSUnrealType>()>* FactoryMethod = MetaDataFactoryMap.Find(PropertyType))
+	TSharedPtr<FCSUnrealType> MetaData = CreateEmpty(PropertyType);
+	MetaData->SerializeFromJson(PropertyTypeObject);
+	return MetaData;
+}
+
+TSharedPtr<FCSUnrealType> CSMetaDataFactory::Create(FCSMetaDataReader& Reader)
+{
+	ECSPropertyType PropertyType = static_cast<ECSPropertyType>(Reader.ReadUInt8());
+	
+	TSharedPtr<FCSUnrealType> MetaData = CreateEmpty(PropertyType);
+	MetaData->PropertyType = PropertyType;
+	MetaData->SerializeFromBinary(Reader);
+	return MetaData;
+}
+
+TSharedPtr<FCSUnrealType> CSMetaDataFactory::CreateEmpty(ECSPropertyType PropertyType)
+{
+	// Metadata is deserialized from worker threads, so the map has to be filled exactly once before the first lookup.
+	static const bool bInitialized = []
 	{
-		MetaData = (*FactoryMethod)();
-	}
-	else
+		Initialize();
+		return true;
+	}();
+	
+	if (TFunction<TSharedPtr<FCSUnrealType>()>* FactoryMethod = MetaDataFactoryMap.Find(PropertyType))
 	{
-		MetaData = MakeShared<FCSUnrealType>();
+		return (*FactoryMethod)();
 	}
-
-	MetaData->SerializeFromJson(PropertyTypeObject);
-	return MetaData;
+	
+	return MakeShared<FCSUnrealType>();
 }
@@ -2,6 +2,8 @@
 
 #include "TypeGenerator/Register/MetaData/CSUnrealType.h"
 
+class FCSMetaDataReader;
+
 #define REGISTER_METADATA_WITH_NAME(CustomName, MetaDataName) \
 	MetaDataFactoryMap.Add(CustomName, \
 		[]() \
@@ -17,7 +19,9 @@ class CSMetaDataFactory
 public:
 	
 	static TSharedPtr<FCSUnrealType> Create(const TSharedPtr<FJsonObject>& PropertyMetaData);
+	static TSharedPtr<FCSUnrealType> Create(FCSMetaDataReader& Reader);
 	
 private:
+	static TSharedPtr<FCSUnrealType> CreateEmpty(ECSPropertyType PropertyType);
 	static void Initialize();
 };
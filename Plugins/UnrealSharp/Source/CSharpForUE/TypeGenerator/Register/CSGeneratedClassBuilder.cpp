@@ -6,6 +6,8 @@
 #include "UObject/UnrealType.h"
 #include "Engine/Blueprint.h"
 #include "CSharpForUE/TypeGenerator/CSClass.h"
+#include "CSharpForUE/TypeGenerator/CSFunction.h"
+#include "UObject/UObjectHash.h"
 #include "CSharpForUE/TypeGenerator/Factories/CSFunctionFactory.h"
 #include "CSharpForUE/TypeGenerator/Factories/CSPropertyFactory.h"
 #include "MetaData/CSDefaultComponentMetaData.h"
@@ -116,7 +118,7 @@ void FCSGeneratedClassBuilder::ObjectConstructor(const FObjectInitializer& Objec
 	InitialSetup(ObjectInitializer, ClassInfo, ManagedClass);
 	
 	// Make the actual object in C#
-	FCSManager::Get().CreateNewManagedObject(ObjectInitializer.GetObj(), ClassInfo->TypeHandle);
+	FCSManager::Get().CreateNewManagedObjectDeferred(ObjectInitializer.GetObj(), ClassInfo->TypeHandle);
 }
 
 void FCSGeneratedClassBuilder::ActorComponentConstructor(const FObjectInitializer& ObjectInitializer)
@@ -130,7 +132,7 @@ void FCSGeneratedClassBuilder::ActorComponentConstructor(const FObjectInitialize
 	ActorComponent->PrimaryComponentTick.bStartWithTickEnabled = ManagedClass->bCanTick;
 	
 	// Make the actual object in C#
-	FCSManager::Get().CreateNewManagedObject(ObjectInitializer.GetObj(), ClassInfo->TypeHandle);
+	FCSManager::Get().CreateNewManagedObjectDeferred(ObjectInitializer.GetObj(), ClassInfo->TypeHandle);
 }
 
 void FCSGeneratedClassBuilder::ActorConstructor(const FObjectInitializer& ObjectInitializer)
@@ -146,7 +148,7 @@ void FCSGeneratedClassBuilder::ActorConstructor(const FObjectInitializer& Object
 	SetupDefaultSubobjects(ObjectInitializer, Actor, ObjectInitializer.GetClass(), ManagedClass, ClassInfo);
 	
 	// Make the actual object in C#
-	FCSManager::Get().CreateNewManagedObject(ObjectInitializer.GetObj(), ClassInfo->TypeHandle);
+	FCSManager::Get().CreateNewManagedObjectDeferred(ObjectInitializer.GetObj(), ClassInfo->TypeHandle);
 }
 
 void FCSGeneratedClassBuilder::InitialSetup(const FObjectInitializer& ObjectInitializer, TSharedPtr<FCSharpClassInfo>& ClassInfo, UCSClass*& ManagedClass)
@@ -246,12 +248,71 @@ void FCSGeneratedClassBuilder::ImplementInterfaces(UClass* ManagedClass, const T
 
 void* FCSGeneratedClassBuilder::TryGetManagedFunction(UClass* Outer, const FName& MethodName)
 {
-	if (UCSClass* ManagedClass = GetFirstManagedClass(Outer))
+	return LookupManagedMethod(Outer, FString::Printf(TEXT("Invoke_%s"), *MethodName.ToString()));
+}
+
+void* FCSGeneratedClassBuilder::TryGetNativeEntryPoint(UClass* Outer, const FName& MethodName)
+{
+	return LookupManagedMethod(Outer, FString::Printf(TEXT("InvokeUnmanaged_%s"), *MethodName.ToString()));
+}
+
+void* FCSGeneratedClassBuilder::LookupManagedMethod(UClass* Outer, const FString& MethodName)
+{
+	UCSClass* ManagedClass = GetFirstManagedClass(Outer);
+	if (!ManagedClass)
+	{
+		return nullptr;
+	}
+
+	// The method tables are keyed by declaring type, so walk up the managed hierarchy like the reflection lookup does.
+	const FName MethodFName(*MethodName);
+	for (UCSClass* Class = ManagedClass; Class; Class = GetFirstManagedClass(Class->GetSuperClass()))
+	{
+		if (void* ManagedMethod = FCSManager::Get().FindManagedMethod(Class->GetClassInfo()->TypeHandle, MethodFName))
+		{
+			return ManagedMethod;
+		}
+	}
+
+	// Not in any table, e.g. an assembly woven before method tables existed.
+	return FCSManagedCallbacks::ManagedCallbacks.LookupManagedMethod(ManagedClass->GetClassInfo()->TypeHandle, *MethodName);
+}
+
+void FCSGeneratedClassBuilder::RebindClassInfo(UCSClass* Class, const TSharedPtr<FCSharpClassInfo>& ClassInfo)
+{
+	Class->ClassMetaData = ClassInfo;
+}
+
+void FCSGeneratedClassBuilder::RebindManagedMethods(UCSClass* Class)
+{
+	for (TFieldIterator<UCSFunction> It(Class, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		UCSFunction* Function = *It;
+		Function->SetManagedMethod(TryGetManagedFunction(Class, Function->GetFName()));
+
+		if (Function->GetNativeEntryPoint())
+		{
+			Function->SetNativeEntryPoint(static_cast<FCSNativeEntryPoint>(TryGetNativeEntryPoint(Class, Function->GetFName())));
+		}
+	}
+}
+
+void FCSGeneratedClassBuilder::RebindManagedObjects(UCSClass* Class)
+{
+	TArray<UObject*> Objects;
+	GetObjectsOfClass(Class, Objects, true, RF_NoFlags);
+
+	FCSManager& Manager = FCSManager::Get();
+	uint8* TypeHandle = Class->GetClassInfo()->TypeHandle;
+	
+	for (UObject* Object : Objects)
 	{
-		const FString InvokeMethodName = FString::Printf(TEXT("Invoke_%s"), *MethodName.ToString());
-		return FCSManagedCallbacks::ManagedCallbacks.LookupManagedMethod(ManagedClass->GetClassInfo()->TypeHandle, *InvokeMethodName);
+		// Blueprint children of a C# child class are handled by that class.
+		if (GetFirstManagedClass(Object->GetClass()) == Class)
+		{
+			Manager.RebindManagedObject(Object, TypeHandle);
+		}
 	}
-	return nullptr;
 }
 
 UCSClass* FCSGeneratedClassBuilder::GetFirstManagedClass(UClass* Class)
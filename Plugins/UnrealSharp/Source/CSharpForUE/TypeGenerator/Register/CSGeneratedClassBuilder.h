@@ -17,14 +17,26 @@ public:
 	// End of implementation
 	
 	static void* TryGetManagedFunction(UClass* Outer, const FName& MethodName);
+	static void* TryGetNativeEntryPoint(UClass* Outer, const FName& MethodName);
 
 	static UCSClass* GetFirstManagedClass(UClass* Class);
 	static UClass* GetFirstNativeClass(UClass* Class);
 	static UClass* GetFirstNonBlueprintClass(UClass* Class);
 
 	static bool IsManagedType(const UClass* Class);
+
+	// Used by hot reload for classes that didn't change, so they can be kept instead of being rebuilt and reinstanced.
+	// The class info of every kept class has to be rebound before any managed methods, since the lookup walks the managed parents.
+	static void RebindClassInfo(UCSClass* Class, const TSharedPtr<FCSharpClassInfo>& ClassInfo);
+	static void RebindManagedMethods(UCSClass* Class);
+
+	// The managed objects of existing instances belong to the unloaded assembly. Their state is moved into objects of the reloaded type,
+	// without running the C# constructor again.
+	static void RebindManagedObjects(UCSClass* Class);
 		
 private:
+
+	static void* LookupManagedMethod(UClass* Outer, const FString& MethodName);
 	
 	static void ObjectConstructor(const FObjectInitializer& ObjectInitializer);
 	static void ActorComponentConstructor(const FObjectInitializer& ObjectInitializer);
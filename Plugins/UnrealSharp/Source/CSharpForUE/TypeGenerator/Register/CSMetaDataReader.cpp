@@ -0,0 +1,223 @@
+﻿#include "CSMetaDataReader.h"
+#include "CSharpForUE/CSharpForUE.h"
+#include "HAL/PlatformFileManager.h"
+#include "Async/MappedFileHandle.h"
+#include "Hash/CityHash.h"
+#include "Misc/FileHelper.h"
+
+FCSMetaDataReader::~FCSMetaDataReader()
+{
+	// The region has to be released before the handle it was mapped from.
+	MappedRegion.Reset();
+	MappedFile.Reset();
+}
+
+bool FCSMetaDataReader::Open(const FString& FilePath)
+{
+	MappedFile.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*FilePath));
+	if (MappedFile.IsValid())
+	{
+		MappedRegion.Reset(MappedFile->MapRegion());
+	}
+
+	if (MappedRegion.IsValid())
+	{
+		Data = MappedRegion->GetMappedPtr();
+		DataSize = MappedRegion->GetMappedSize();
+	}
+	else
+	{
+		if (!FFileHelper::LoadFileToArray(FileData, *FilePath))
+		{
+			return false;
+		}
+		
+		Data = FileData.GetData();
+		DataSize = FileData.Num();
+	}
+
+	uint32 FileMagic = 0;
+	uint32 FileVersion = 0;
+	ReadBytes(&FileMagic, sizeof(FileMagic));
+	ReadBytes(&FileVersion, sizeof(FileVersion));
+
+	if (bHasError || FileMagic != Magic || FileVersion != Version)
+	{
+		UE_LOG(LogUnrealSharp, Warning, TEXT("%s is not a supported metadata file (version %u, expected %u)."), *FilePath, FileVersion, Version);
+		return false;
+	}
+
+	return ReadStringTable();
+}
+
+int32 FCSMetaDataReader::ReadInt32()
+{
+	int32 Value = 0;
+	ReadBytes(&Value, sizeof(Value));
+	HashBytes(&Value, sizeof(Value));
+	return Value;
+}
+
+uint64 FCSMetaDataReader::ReadUInt64()
+{
+	uint64 Value = 0;
+	ReadBytes(&Value, sizeof(Value));
+	HashBytes(&Value, sizeof(Value));
+	return Value;
+}
+
+uint8 FCSMetaDataReader::ReadUInt8()
+{
+	uint8 Value = 0;
+	ReadBytes(&Value, sizeof(Value));
+	HashBytes(&Value, sizeof(Value));
+	return Value;
+}
+
+const FString& FCSMetaDataReader::ReadString()
+{
+	static const FString EmptyString;
+	
+	const int32 Index = ReadStringIndex();
+	if (Index == INDEX_NONE)
+	{
+		return EmptyString;
+	}
+
+	if (!Strings.IsValidIndex(Index))
+	{
+		SetError(TEXT("String index out of range"));
+		return EmptyString;
+	}
+	
+	return Strings[Index];
+}
+
+FName FCSMetaDataReader::ReadName()
+{
+	const int32 Index = ReadStringIndex();
+	if (Index == INDEX_NONE)
+	{
+		return NAME_None;
+	}
+
+	if (!Strings.IsValidIndex(Index))
+	{
+		SetError(TEXT("String index out of range"));
+		return NAME_None;
+	}
+
+	// Type, namespace and assembly names repeat a lot, so only create each FName once.
+	if (!NamesCreated[Index])
+	{
+		Names[Index] = FName(*Strings[Index]);
+		NamesCreated[Index] = true;
+	}
+
+	ReferencedNames.Add(Names[Index]);
+	return Names[Index];
+}
+
+void FCSMetaDataReader::ReadMetaDataMap(TMap<FString, FString>& OutMetaData)
+{
+	const int32 Count = ReadCount();
+	OutMetaData.Reserve(OutMetaData.Num() + Count);
+	
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const FString& Key = ReadString();
+		const FString& Value = ReadString();
+		OutMetaData.Add(Key, Value);
+	}
+}
+
+int32 FCSMetaDataReader::ReadCount()
+{
+	const int32 Count = ReadInt32();
+	
+	// Every element takes at least one byte, so anything larger is a corrupt file.
+	if (Count < 0 || Count > DataSize - Position)
+	{
+		SetError(TEXT("Invalid array count"));
+		return 0;
+	}
+	
+	return Count;
+}
+
+void FCSMetaDataReader::ResetContentHash()
+{
+	ContentHash = 0;
+	ReferencedNames.Reset();
+}
+
+int32 FCSMetaDataReader::ReadStringIndex()
+{
+	int32 Index = INDEX_NONE;
+	ReadBytes(&Index, sizeof(Index));
+
+	if (Strings.IsValidIndex(Index))
+	{
+		const FString& String = Strings[Index];
+		const int32 Length = String.Len();
+		HashBytes(&Length, sizeof(Length));
+		HashBytes(*String, Length * sizeof(TCHAR));
+	}
+	else
+	{
+		HashBytes(&Index, sizeof(Index));
+	}
+	
+	return Index;
+}
+
+void FCSMetaDataReader::HashBytes(const void* InData, int64 Size)
+{
+	ContentHash = CityHash64WithSeed(static_cast<const char*>(InData), static_cast<uint32>(Size), ContentHash);
+}
+
+bool FCSMetaDataReader::ReadBytes(void* OutData, int64 Size)
+{
+	if (bHasError || Position + Size > DataSize)
+	{
+		SetError(TEXT("Unexpected end of file"));
+		return false;
+	}
+
+	FMemory::Memcpy(OutData, Data + Position, Size);
+	Position += Size;
+	return true;
+}
+
+bool FCSMetaDataReader::ReadStringTable()
+{
+	const int32 NumStrings = ReadCount();
+	Strings.Reserve(NumStrings);
+
+	for (int32 i = 0; i < NumStrings && !bHasError; ++i)
+	{
+		const int32 Length = ReadCount();
+		if (bHasError)
+		{
+			break;
+		}
+
+		const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Data + Position), Length);
+		Strings.Emplace(Converted.Length(), Converted.Get());
+		Position += Length;
+	}
+
+	Names.SetNum(Strings.Num());
+	NamesCreated.Init(false, Strings.Num());
+	return !bHasError;
+}
+
+void FCSMetaDataReader::SetError(const TCHAR* Reason)
+{
+	if (!bHasError)
+	{
+		UE_LOG(LogUnrealSharp, Warning, TEXT("Failed to read binary metadata at offset %lld: %s"), Position, Reason);
+	}
+	
+	bHasError = true;
+}
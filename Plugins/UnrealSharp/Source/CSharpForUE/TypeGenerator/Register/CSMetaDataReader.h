@@ -0,0 +1,77 @@
+﻿#pragma once
+
+#include "CoreMinimal.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+// Reads the binary <Assembly>.metadata file the weaver writes next to the JSON metadata.
+// Layout: magic, version, an interned UTF-8 string table, then flat arrays of classes, structs, enums and interfaces.
+// Strings are referenced by their index in the table, INDEX_NONE meaning no value.
+class CSHARPFORUE_API FCSMetaDataReader
+{
+public:
+
+	static constexpr uint32 Magic = 0x444D5355; // "USMD"
+	static constexpr uint32 Version = 1;
+
+	FCSMetaDataReader() = default;
+	~FCSMetaDataReader();
+
+	// Memory maps the file if the platform supports it, otherwise reads it into memory.
+	bool Open(const FString& FilePath);
+
+	int32 ReadInt32();
+	uint64 ReadUInt64();
+	uint8 ReadUInt8();
+	bool ReadBool() { return ReadUInt8() != 0; }
+
+	const FString& ReadString();
+	FName ReadName();
+	void ReadMetaDataMap(TMap<FString, FString>& OutMetaData);
+
+	// Reads an array count, guarding against counts that can't fit in the remaining data.
+	int32 ReadCount();
+
+	template<typename FlagType>
+	FlagType ReadFlags()
+	{
+		return static_cast<FlagType>(ReadUInt64());
+	}
+
+	bool HasError() const { return bHasError; }
+
+	// Hash of everything read since the last reset. Strings are hashed by content rather than by table index,
+	// so a type's hash doesn't change when unrelated strings are added to the table. 64 bits wide, since a collision
+	// would keep a changed type on hot reload.
+	void ResetContentHash();
+	uint64 GetContentHash() const { return ContentHash; }
+
+	// Every name read since the last reset, a superset of the types the current type references.
+	TArray<FName> ConsumeReferencedNames() { return MoveTemp(ReferencedNames); }
+	
+private:
+
+	bool ReadBytes(void* OutData, int64 Size);
+	int32 ReadStringIndex();
+	void HashBytes(const void* InData, int64 Size);
+	bool ReadStringTable();
+	void SetError(const TCHAR* Reason);
+
+	TUniquePtr<IMappedFileHandle> MappedFile;
+	TUniquePtr<IMappedFileRegion> MappedRegion;
+	TArray<uint8> FileData;
+	
+	const uint8* Data = nullptr;
+	int64 DataSize = 0;
+	int64 Position = 0;
+
+	TArray<FString> Strings;
+	TArray<FName> Names;
+	TBitArray<> NamesCreated;
+
+	uint64 ContentHash = 0;
+	TArray<FName> ReferencedNames;
+
+	bool bHasError = false;
+};
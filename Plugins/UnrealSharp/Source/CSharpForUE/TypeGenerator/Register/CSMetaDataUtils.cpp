@@ -1,6 +1,7 @@
 #include "CSMetaDataUtils.h"
 #include "Dom/JsonObject.h"
 #include "UObject/UnrealType.h"
+#include "CSMetaDataReader.h"
 #include "CSharpForUE/TypeGenerator/Factories/CSMetaDataFactory.h"
 
 //START ----------------------CSharpMetaDataUtils----------------------------------------
@@ -35,6 +36,39 @@ void FCSMetaDataUtils::SerializeProperty(const TSharedPtr<FJsonObject>& Property
 	PropertiesMetaData.SerializeFromJson(PropertyMetaData);
 }
 
+void FCSMetaDataUtils::SerializeFunctions(FCSMetaDataReader& Reader, TArray<FCSFunctionMetaData>& FunctionMetaData)
+{
+	const int32 NumFunctions = Reader.ReadCount();
+	FunctionMetaData.Reserve(NumFunctions);
+
+	for (int32 i = 0; i < NumFunctions; ++i)
+	{
+		FCSFunctionMetaData NewFunctionMetaData;
+		NewFunctionMetaData.SerializeFromBinary(Reader);
+		FunctionMetaData.Emplace(MoveTemp(NewFunctionMetaData));
+	}
+}
+
+void FCSMetaDataUtils::SerializeProperties(FCSMetaDataReader& Reader, TArray<FCSPropertyMetaData>& PropertiesMetaData)
+{
+	const int32 NumProperties = Reader.ReadCount();
+	PropertiesMetaData.Reserve(NumProperties);
+
+	for (int32 i = 0; i < NumProperties; ++i)
+	{
+		FCSPropertyMetaData NewPropertyMetaData;
+		SerializeProperty(Reader, NewPropertyMetaData);
+		PropertiesMetaData.Emplace(MoveTemp(NewPropertyMetaData));
+	}
+}
+
+void FCSMetaDataUtils::SerializeProperty(FCSMetaDataReader& Reader, FCSPropertyMetaData& PropertyMetaData)
+{
+	// Same order as the weaver writes it: the property type first, then the rest of the property.
+	PropertyMetaData.Type = CSMetaDataFactory::Create(Reader);
+	PropertyMetaData.SerializeFromBinary(Reader);
+}
+
 void FCSMetaDataUtils::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject, TMap<FString, FString>& MetaDataMap)
 {
 	const TSharedPtr<FJsonObject>* MetaDataObjectPtr;
@@ -7,12 +7,18 @@
 #include "MetaData/CSFunctionMetaData.h"
 #include "UObject/ObjectMacros.h"
 
+class FCSMetaDataReader;
+
 namespace FCSMetaDataUtils
 {
 	void SerializeFunctions(const TArray<TSharedPtr<FJsonValue>>& FunctionsInfo, TArray<FCSFunctionMetaData>& FunctionMetaData);
 	void SerializeProperties(const TArray<TSharedPtr<FJsonValue>>& PropertiesInfo, TArray<FCSPropertyMetaData>& PropertiesMetaData, EPropertyFlags DefaultFlags = CPF_None);
 	void SerializeProperty(const TSharedPtr<FJsonObject>& PropertyMetaData, FCSPropertyMetaData& PropertiesMetaData, EPropertyFlags DefaultFlags = CPF_None);
 
+	void SerializeFunctions(FCSMetaDataReader& Reader, TArray<FCSFunctionMetaData>& FunctionMetaData);
+	void SerializeProperties(FCSMetaDataReader& Reader, TArray<FCSPropertyMetaData>& PropertiesMetaData);
+	void SerializeProperty(FCSMetaDataReader& Reader, FCSPropertyMetaData& PropertyMetaData);
+
 	template<typename FlagType>
 	FlagType GetFlags(const TSharedPtr<FJsonObject>& PropertyInfo, const FString& StringField)
 	{
@@ -1,6 +1,11 @@
 #include "CSTypeRegistry.h"
 #include "CSharpForUE/CSharpForUE.h"
+#include "CSMetaDataReader.h"
+#include "CSharpForUE/CSDeveloperSettings.h"
+#include "Misc/CoreDelegates.h"
 #include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Async/ParallelFor.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonReader.h"
 #include "TypeInfo/CSClassInfo.h"
@@ -16,59 +21,360 @@ void InitializeBuilders(TMap<FName, T>& Map)
 	}
 }
 
+template<typename TInfo>
+void AddTypeInfos(TMap<FName, TSharedPtr<TInfo>>& Map, const TArray<TSharedPtr<TInfo>>& Infos)
+{
+	Map.Reserve(Map.Num() + Infos.Num());
+	
+	for (const TSharedPtr<TInfo>& Info : Infos)
+	{
+		Map.Add(Info->TypeMetaData->Name, Info);
+	}
+}
+
+template<typename TInfo>
+void ParseTypeInfos(const TArray<TSharedPtr<FJsonValue>>& MetaData, TArray<TSharedPtr<TInfo>>& OutInfos)
+{
+	OutInfos.SetNum(MetaData.Num());
+
+	// Parsing only fills in metadata and never touches UObjects, so every type can be parsed on its own.
+	ParallelFor(MetaData.Num(), [&MetaData, &OutInfos](int32 Index)
+	{
+		OutInfos[Index] = MakeShared<TInfo>(MetaData[Index]);
+	});
+}
+
+template<typename TInfo>
+bool IsTypeUnchanged(const TMap<FName, TSharedPtr<TInfo>>& Map, const TSharedPtr<TInfo>& NewInfo)
+{
+	const TSharedPtr<TInfo> OldInfo = Map.FindRef(NewInfo->TypeMetaData->Name);
+	return OldInfo.IsValid() && OldInfo->Field && NewInfo->ContentHash != 0 && OldInfo->ContentHash == NewInfo->ContentHash;
+}
+
+template<typename TInfo>
+bool AreAllTypesUnchanged(const TMap<FName, TSharedPtr<TInfo>>& Map, const TArray<TSharedPtr<TInfo>>& NewInfos)
+{
+	for (const TSharedPtr<TInfo>& NewInfo : NewInfos)
+	{
+		if (!IsTypeUnchanged(Map, NewInfo))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+template<typename TInfo>
+void ReuseTypes(const TMap<FName, TSharedPtr<TInfo>>& Map, const TArray<TSharedPtr<TInfo>>& NewInfos)
+{
+	for (const TSharedPtr<TInfo>& NewInfo : NewInfos)
+	{
+		NewInfo->Field = Map.FindRef(NewInfo->TypeMetaData->Name)->Field;
+	}
+}
+
+void ResolveTypeHandles(const TArray<TSharedPtr<FCSharpClassInfo>>& ClassInfos)
+{
+	for (const TSharedPtr<FCSharpClassInfo>& ClassInfo : ClassInfos)
+	{
+		ClassInfo->TypeHandle = FCSManager::Get().GetTypeHandle(*ClassInfo->TypeMetaData);
+	}
+}
+
 bool FCSTypeRegistry::ProcessMetaData(const FString& FilePath)
 {
-	if (!FPaths::FileExists(FilePath))
+	const double ParseStartTime = FPlatformTime::Seconds();
+	
+	// The weaver writes a binary copy of the metadata next to the JSON file. It is much cheaper to load,
+	// so prefer it and only parse the JSON when it is missing or can't be read.
+	FCSTypeInfos TypeInfos;
+	const bool bFromBinary = ReadBinaryMetaData(FPaths::ChangeExtension(FilePath, TEXT("metadata")), TypeInfos);
+	
+	if (!bFromBinary && !ReadJsonMetaData(FilePath, TypeInfos))
 	{
-		UE_LOG(LogUnrealSharp, Fatal, TEXT("Couldn't find metadata file at: %s"), *FilePath);
 		return false;
 	}
 
-	FString JsonString;
-	if (!FFileHelper::LoadFileToString(JsonString, *FilePath))
+	const double RegisterStartTime = FPlatformTime::Seconds();
+
+	// The type handle lookup calls into the managed assembly, so it stays on the game thread.
+	ResolveTypeHandles(TypeInfos.Classes);
+
+	// Only the binary metadata has content hashes, types loaded from JSON are always rebuilt.
+	if (bFromBinary)
+	{
+		ReuseUnchangedTypes(TypeInfos.Classes, TypeInfos.Structs, TypeInfos.Interfaces);
+	}
+
+	AddTypeInfos(ManagedClasses, TypeInfos.Classes);
+	AddTypeInfos(ManagedStructs, TypeInfos.Structs);
+	AddTypeInfos(ManagedEnums, TypeInfos.Enums);
+	AddTypeInfos(ManagedInterfaces, TypeInfos.Interfaces);
+
+	const double BuildStartTime = FPlatformTime::Seconds();
+
+	if (ShouldConstructTypesLazily() && !bConstructedAllTypes)
+	{
+		// Types get built the first time they're looked up by name, or when content that references them is loaded.
+		ConstructEagerTypes();
+	}
+	else
+	{
+		ConstructAllTypes();
+	}
+
+	const double EndTime = FPlatformTime::Seconds();
+	UE_LOG(LogUnrealSharp, Log, TEXT("Processed metadata at %s: parsing took %f seconds, registering types took %f seconds, building types took %f seconds."),
+		*FilePath, RegisterStartTime - ParseStartTime, BuildStartTime - RegisterStartTime, EndTime - BuildStartTime);
+	return true;
+}
+
+bool FCSTypeRegistry::ShouldConstructTypesLazily() const
+{
+	return !GIsEditor && GetDefault<UCSDeveloperSettings>()->bLazyTypeConstruction;
+}
+
+void FCSTypeRegistry::ConstructAllTypes()
+{
+	InitializeBuilders(ManagedClasses);
+	InitializeBuilders(ManagedStructs);
+	InitializeBuilders(ManagedEnums);
+	InitializeBuilders(ManagedInterfaces);
+}
+
+void FCSTypeRegistry::ConstructEagerTypes()
+{
+	if (!SyncLoadPackageHandle.IsValid())
+	{
+		if (!LoadCookedTypeReferences())
+		{
+			// Without the list there's no telling which content needs which types.
+			UE_LOG(LogUnrealSharp, Warning, TEXT("No C# type references at %s, constructing all types. Cook the project to write them."), *FCSProcHelper::GetCookedTypeReferencesPath());
+			bConstructedAllTypes = true;
+			ConstructAllTypes();
+			return;
+		}
+		
+		SyncLoadPackageHandle = FCoreDelegates::OnSyncLoadPackage.AddRaw(this, &FCSTypeRegistry::OnPackageLoadStarted);
+		AsyncLoadPackageHandle = FCoreDelegates::OnAsyncLoadPackage.AddRaw(this, &FCSTypeRegistry::OnPackageLoadStarted);
+	}
+	
+	for (const FName& TypeName : GetDefault<UCSDeveloperSettings>()->EagerlyConstructedTypes)
+	{
+		ResolveType(TypeName);
+	}
+}
+
+void FCSTypeRegistry::ResolveType(FName TypeName)
+{
+	if (ManagedClasses.Contains(TypeName))
+	{
+		GetClassFromName(TypeName);
+	}
+	else if (ManagedStructs.Contains(TypeName))
+	{
+		GetStructFromName(TypeName);
+	}
+	else if (ManagedEnums.Contains(TypeName))
+	{
+		GetEnumFromName(TypeName);
+	}
+	else if (ManagedInterfaces.Contains(TypeName))
+	{
+		GetInterfaceFromName(TypeName);
+	}
+}
+
+bool FCSTypeRegistry::LoadCookedTypeReferences()
+{
+	FString Json;
+	if (!FFileHelper::LoadFileToString(Json, *FCSProcHelper::GetCookedTypeReferencesPath()))
 	{
-		UE_LOG(LogUnrealSharp, Fatal, TEXT("Failed to load MetaDataPath at: %s"), *FilePath);
 		return false;
 	}
 
-	TSharedPtr<FJsonObject> JsonObject;
-	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(JsonString), JsonObject) || !JsonObject.IsValid())
+	TSharedPtr<FJsonObject> Root;
+	const TSharedPtr<FJsonObject>* Packages;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Root) || !Root.IsValid() || !Root->TryGetObjectField(TEXT("Packages"), Packages))
 	{
-		UE_LOG(LogUnrealSharp, Fatal, TEXT("Failed to parse JSON at: %s"), *FilePath);
 		return false;
 	}
+
+	CookedTypeReferences.Reserve((*Packages)->Values.Num());
 	
-	for (const auto& MetaData : JsonObject->GetArrayField(TEXT("ClassMetaData")))
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*Packages)->Values)
 	{
-		TSharedPtr<FCSharpClassInfo> ClassInfo = MakeShared<FCSharpClassInfo>(MetaData);
-		ManagedClasses.Add(ClassInfo->TypeMetaData->Name, ClassInfo);
+		TArray<FName>& Types = CookedTypeReferences.Add(*Pair.Key);
+		
+		for (const TSharedPtr<FJsonValue>& Type : Pair.Value->AsArray())
+		{
+			Types.Add(*Type->AsString());
+		}
 	}
 
-	const TArray<TSharedPtr<FJsonValue>>& StructMetaData = JsonObject->GetArrayField(TEXT("StructMetaData"));
-	for (const auto& MetaData : StructMetaData)
+	return true;
+}
+
+void FCSTypeRegistry::OnPackageLoadStarted(const FString& PackageName)
+{
+	if (bConstructedAllTypes)
 	{
-		TSharedPtr<FCSharpStructInfo> StructInfo = MakeShared<FCSharpStructInfo>(MetaData);
-		ManagedStructs.Add(StructInfo->TypeMetaData->Name, StructInfo);
+		return;
 	}
 
-	const TArray<TSharedPtr<FJsonValue>>& EnumMetaData = JsonObject->GetArrayField(TEXT("EnumMetaData"));
-	for (const auto& MetaData : EnumMetaData)
+	// The list already includes the types of the package's whole dependency tree, since dependencies load without a callback of their own.
+	if (const TArray<FName>* Types = CookedTypeReferences.Find(*FPackageName::ObjectPathToPackageName(PackageName)))
 	{
-		TSharedPtr<FCSharpEnumInfo> EnumInfo = MakeShared<FCSharpEnumInfo>(MetaData);
-		ManagedEnums.Add(EnumInfo->TypeMetaData->Name, EnumInfo);
+		for (const FName& TypeName : *Types)
+		{
+			ResolveType(TypeName);
+		}
 	}
+}
 
-	const TArray<TSharedPtr<FJsonValue>>& InterfacesMetaData = JsonObject->GetArrayField(TEXT("InterfacesMetaData"));
-	for (const auto& MetaData : InterfacesMetaData)
+template<typename TInfo>
+bool FCSTypeRegistry::ReadTypeInfos(FCSMetaDataReader& Reader, TArray<TSharedPtr<TInfo>>& OutInfos)
+{
+	const int32 NumInfos = Reader.ReadCount();
+	OutInfos.Reserve(NumInfos);
+	
+	for (int32 i = 0; i < NumInfos && !Reader.HasError(); ++i)
 	{
-		TSharedPtr<FCSharpInterfaceInfo> InterfaceInfo = MakeShared<FCSharpInterfaceInfo>(MetaData);
-		ManagedInterfaces.Add(InterfaceInfo->TypeMetaData->Name, InterfaceInfo);
+		OutInfos.Add(MakeShared<TInfo>(Reader));
 	}
 
-	InitializeBuilders(ManagedClasses);
-	InitializeBuilders(ManagedStructs);
-	InitializeBuilders(ManagedEnums);
-	InitializeBuilders(ManagedInterfaces);
+	return !Reader.HasError();
+}
+
+bool FCSTypeRegistry::ReadBinaryMetaData(const FString& FilePath, FCSTypeInfos& OutTypeInfos)
+{
+	if (!FPaths::FileExists(FilePath))
+	{
+		return false;
+	}
+
+	FCSMetaDataReader Reader;
+	if (!Reader.Open(FilePath))
+	{
+		return false;
+	}
+
+	// Read everything before touching the registry, so a truncated file can still fall back to JSON.
+	if (!ReadTypeInfos(Reader, OutTypeInfos.Classes)
+		|| !ReadTypeInfos(Reader, OutTypeInfos.Structs)
+		|| !ReadTypeInfos(Reader, OutTypeInfos.Enums)
+		|| !ReadTypeInfos(Reader, OutTypeInfos.Interfaces))
+	{
+		UE_LOG(LogUnrealSharp, Warning, TEXT("Failed to read binary metadata at: %s. Falling back to JSON."), *FilePath);
+		OutTypeInfos = FCSTypeInfos();
+		return false;
+	}
+
+	return true;
+}
+
+void FCSTypeRegistry::ReuseUnchangedTypes(const TArray<TSharedPtr<FCSharpClassInfo>>& ClassInfos,
+	const TArray<TSharedPtr<FCSharpStructInfo>>& StructInfos,
+	const TArray<TSharedPtr<FCSharpInterfaceInfo>>& InterfaceInfos)
+{
+	// Structs and interfaces end up in the layout and signatures of the types that use them, and their users aren't tracked,
+	// so any change to them rebuilds everything.
+	if (!AreAllTypesUnchanged(ManagedStructs, StructInfos) || !AreAllTypesUnchanged(ManagedInterfaces, InterfaceInfos))
+	{
+		return;
+	}
+
+	ReuseTypes(ManagedStructs, StructInfos);
+	ReuseTypes(ManagedInterfaces, InterfaceInfos);
+
+	TSet<FName> RebuiltClasses;
+	for (const TSharedPtr<FCSharpClassInfo>& ClassInfo : ClassInfos)
+	{
+		if (!IsTypeUnchanged(ManagedClasses, ClassInfo))
+		{
+			RebuiltClasses.Add(ClassInfo->TypeMetaData->Name);
+		}
+	}
+
+	// Classes that derive from or refer to a rebuilt class have to be rebuilt with it, so their properties and functions point at the new class.
+	bool bFoundDependents = RebuiltClasses.Num() > 0;
+	while (bFoundDependents)
+	{
+		bFoundDependents = false;
+		
+		for (const TSharedPtr<FCSharpClassInfo>& ClassInfo : ClassInfos)
+		{
+			const FName ClassName = ClassInfo->TypeMetaData->Name;
+			if (RebuiltClasses.Contains(ClassName))
+			{
+				continue;
+			}
+
+			for (const FName& ReferencedName : ClassInfo->ReferencedNames)
+			{
+				if (RebuiltClasses.Contains(ReferencedName))
+				{
+					RebuiltClasses.Add(ClassName);
+					bFoundDependents = true;
+					break;
+				}
+			}
+		}
+	}
+
+	TArray<UCSClass*> KeptClasses;
+	for (const TSharedPtr<FCSharpClassInfo>& ClassInfo : ClassInfos)
+	{
+		if (RebuiltClasses.Contains(ClassInfo->TypeMetaData->Name))
+		{
+			continue;
+		}
+
+		UCSClass* ExistingClass = CastChecked<UCSClass>(ManagedClasses.FindRef(ClassInfo->TypeMetaData->Name)->Field);
+		ClassInfo->Field = ExistingClass;
+		FCSGeneratedClassBuilder::RebindClassInfo(ExistingClass, ClassInfo);
+		KeptClasses.Add(ExistingClass);
+	}
+
+	for (UCSClass* KeptClass : KeptClasses)
+	{
+		FCSGeneratedClassBuilder::RebindManagedMethods(KeptClass);
+		FCSGeneratedClassBuilder::RebindManagedObjects(KeptClass);
+	}
+
+	if (!KeptClasses.IsEmpty())
+	{
+		UE_LOG(LogUnrealSharp, Log, TEXT("Kept %d unchanged classes, rebuilding %d."), KeptClasses.Num(), RebuiltClasses.Num());
+	}
+}
+
+bool FCSTypeRegistry::ReadJsonMetaData(const FString& FilePath, FCSTypeInfos& OutTypeInfos)
+{
+	if (!FPaths::FileExists(FilePath))
+	{
+		UE_LOG(LogUnrealSharp, Fatal, TEXT("Couldn't find metadata file at: %s"), *FilePath);
+		return false;
+	}
+
+	FString JsonString;
+	if (!FFileHelper::LoadFileToString(JsonString, *FilePath))
+	{
+		UE_LOG(LogUnrealSharp, Fatal, TEXT("Failed to load MetaDataPath at: %s"), *FilePath);
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> JsonObject;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(JsonString), JsonObject) || !JsonObject.IsValid())
+	{
+		UE_LOG(LogUnrealSharp, Fatal, TEXT("Failed to parse JSON at: %s"), *FilePath);
+		return false;
+	}
+	
+	ParseTypeInfos(JsonObject->GetArrayField(TEXT("ClassMetaData")), OutTypeInfos.Classes);
+	ParseTypeInfos(JsonObject->GetArrayField(TEXT("StructMetaData")), OutTypeInfos.Structs);
+	ParseTypeInfos(JsonObject->GetArrayField(TEXT("EnumMetaData")), OutTypeInfos.Enums);
+	ParseTypeInfos(JsonObject->GetArrayField(TEXT("InterfacesMetaData")), OutTypeInfos.Interfaces);
 	return true;
 }
 
@@ -6,6 +6,8 @@
 #include "TypeInfo/CSInterfaceInfo.h"
 #include "TypeInfo/CSStructInfo.h"
 
+class FCSMetaDataReader;
+
 DECLARE_MULTICAST_DELEGATE_TwoParams(FOnNewClass, UClass*, UClass*);
 DECLARE_MULTICAST_DELEGATE_TwoParams(FOnNewStruct, UScriptStruct*, UScriptStruct*);
 DECLARE_MULTICAST_DELEGATE_TwoParams(FOnNewEnum, UEnum*, UEnum*);
@@ -15,6 +17,15 @@ struct FPendingClasses
 	TSet<FCSharpClassInfo*> Classes;
 };
 
+// Type infos read from one metadata file, before they're added to the registry.
+struct FCSTypeInfos
+{
+	TArray<TSharedPtr<FCSharpClassInfo>> Classes;
+	TArray<TSharedPtr<FCSharpStructInfo>> Structs;
+	TArray<TSharedPtr<FCSharpEnumInfo>> Enums;
+	TArray<TSharedPtr<FCSharpInterfaceInfo>> Interfaces;
+};
+
 class CSHARPFORUE_API FCSTypeRegistry
 {
 
@@ -72,10 +83,35 @@ public:
 private:
 	
 	void OnModulesChanged(FName InModuleName, EModuleChangeReason InModuleChangeReason);
+
+	bool ShouldConstructTypesLazily() const;
+	void ConstructAllTypes();
+	void ConstructEagerTypes();
+	void ResolveType(FName TypeName);
+	bool LoadCookedTypeReferences();
+	void OnPackageLoadStarted(const FString& PackageName);
+
+	static bool ReadBinaryMetaData(const FString& FilePath, FCSTypeInfos& OutTypeInfos);
+	static bool ReadJsonMetaData(const FString& FilePath, FCSTypeInfos& OutTypeInfos);
+
+	template<typename TInfo>
+	static bool ReadTypeInfos(FCSMetaDataReader& Reader, TArray<TSharedPtr<TInfo>>& OutInfos);
+
+	// On hot reload, keeps the types whose metadata didn't change so only the changed ones are rebuilt and reinstanced.
+	void ReuseUnchangedTypes(const TArray<TSharedPtr<FCSharpClassInfo>>& ClassInfos,
+		const TArray<TSharedPtr<FCSharpStructInfo>>& StructInfos,
+		const TArray<TSharedPtr<FCSharpInterfaceInfo>>& InterfaceInfos);
 	
 	TMap<FName, FPendingClasses> PendingClasses;
 	
 	FOnNewClass OnNewClass;
 	FOnNewStruct OnNewStruct;
+
+	FDelegateHandle SyncLoadPackageHandle;
+	FDelegateHandle AsyncLoadPackageHandle;
+
+	// The C# types each cooked package needs, written by FCSCookedTypeReferences when cooking.
+	TMap<FName, TArray<FName>> CookedTypeReferences;
+	bool bConstructedAllTypes = false;
 	
 };
\ No newline at end of file
@@ -1,9 +1,16 @@
 ﻿#include "CSArrayPropertyMetaData.h"
 
 #include "TypeGenerator/Register/CSMetaDataUtils.h"
+#include "TypeGenerator/Register/CSMetaDataReader.h"
 
 void FCSArrayPropertyMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
 {
 	FCSUnrealType::SerializeFromJson(JsonObject);
 	FCSMetaDataUtils::SerializeProperty(JsonObject->GetObjectField(TEXT("InnerProperty")), InnerProperty);
 }
+
+void FCSArrayPropertyMetaData::SerializeFromBinary(FCSMetaDataReader& Reader)
+{
+	FCSUnrealType::SerializeFromBinary(Reader);
+	FCSMetaDataUtils::SerializeProperty(Reader, InnerProperty);
+}
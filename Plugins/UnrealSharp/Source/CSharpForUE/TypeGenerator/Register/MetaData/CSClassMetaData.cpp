@@ -1,6 +1,7 @@
 ﻿#include "CSClassMetaData.h"
 
 #include "TypeGenerator/Register/CSMetaDataUtils.h"
+#include "TypeGenerator/Register/CSMetaDataReader.h"
 
 void FCSClassMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
 {
@@ -46,3 +47,30 @@ void FCSClassMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObje
 		FCSMetaDataUtils::SerializeProperties(*FoundProperties, Properties);
 	}
 }
+
+void FCSClassMetaData::SerializeFromBinary(FCSMetaDataReader& Reader)
+{
+	FCSTypeReferenceMetaData::SerializeFromBinary(Reader);
+	ClassFlags = Reader.ReadFlags<EClassFlags>();
+	
+	ParentClass.SerializeFromBinary(Reader);
+	ClassConfigName = Reader.ReadName();
+
+	const int32 NumInterfaces = Reader.ReadCount();
+	Interfaces.Reserve(NumInterfaces);
+	for (int32 i = 0; i < NumInterfaces; ++i)
+	{
+		Interfaces.Add(Reader.ReadName());
+	}
+
+	FCSMetaDataUtils::SerializeFunctions(Reader, Functions);
+
+	const int32 NumVirtualFunctions = Reader.ReadCount();
+	VirtualFunctions.Reserve(NumVirtualFunctions);
+	for (int32 i = 0; i < NumVirtualFunctions; ++i)
+	{
+		VirtualFunctions.Add(Reader.ReadName());
+	}
+
+	FCSMetaDataUtils::SerializeProperties(Reader, Properties);
+}
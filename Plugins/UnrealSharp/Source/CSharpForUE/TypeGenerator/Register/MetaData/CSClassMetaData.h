@@ -27,5 +27,6 @@ struct FCSClassMetaData : public FCSTypeReferenceMetaData
 
 	// FTypeReferenceMetaData interface implementation
 	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject) override;
+	virtual void SerializeFromBinary(FCSMetaDataReader& Reader) override;
 	// End of implementation
 };
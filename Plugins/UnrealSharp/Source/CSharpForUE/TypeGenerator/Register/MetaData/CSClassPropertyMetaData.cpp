@@ -1,4 +1,5 @@
 ﻿#include "CSClassPropertyMetaData.h"
+#include "TypeGenerator/Register/CSMetaDataReader.h"
 
 void FCSClassPropertyMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
 {
@@ -6,3 +7,8 @@ void FCSClassPropertyMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>&
 	TypeRef.SerializeFromJson(JsonObject->GetObjectField(TEXT("InnerType")));
 }
 
+void FCSClassPropertyMetaData::SerializeFromBinary(FCSMetaDataReader& Reader)
+{
+	FCSUnrealType::SerializeFromBinary(Reader);
+	TypeRef.SerializeFromBinary(Reader);
+}
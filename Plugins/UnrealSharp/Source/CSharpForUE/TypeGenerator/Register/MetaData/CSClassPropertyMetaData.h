@@ -11,5 +11,6 @@ struct FCSClassPropertyMetaData : FCSUnrealType
 
 	//FTypeMetaData interface implementation
 	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject) override;
+	virtual void SerializeFromBinary(FCSMetaDataReader& Reader) override;
 	//End of implementation
 };
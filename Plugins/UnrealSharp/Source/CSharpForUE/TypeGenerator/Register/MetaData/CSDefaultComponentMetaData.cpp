@@ -1,4 +1,5 @@
 ﻿#include "CSDefaultComponentMetaData.h"
+#include "TypeGenerator/Register/CSMetaDataReader.h"
 
 void FCSDefaultComponentMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
 {
@@ -16,4 +17,12 @@ void FCSDefaultComponentMetaData::SerializeFromJson(const TSharedPtr<FJsonObject
 	{
 		AttachmentSocket = *AttachmentSocketStr;
 	}
+}
+
+void FCSDefaultComponentMetaData::SerializeFromBinary(FCSMetaDataReader& Reader)
+{
+	FCSObjectMetaData::SerializeFromBinary(Reader);
+	IsRootComponent = Reader.ReadBool();
+	AttachmentComponent = Reader.ReadName();
+	AttachmentSocket = Reader.ReadName();
 }
\ No newline at end of file
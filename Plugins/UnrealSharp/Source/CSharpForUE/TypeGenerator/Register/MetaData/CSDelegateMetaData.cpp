@@ -1,8 +1,16 @@
 ﻿#include "CSDelegateMetaData.h"
+#include "TypeGenerator/Register/CSMetaDataReader.h"
 
 void FCSDelegateMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
 {
 	FCSUnrealType::SerializeFromJson(JsonObject);
 	SignatureFunction.SerializeFromJson(JsonObject->GetObjectField(TEXT("Signature")));
 	SignatureFunction.Name = "";
+}
+
+void FCSDelegateMetaData::SerializeFromBinary(FCSMetaDataReader& Reader)
+{
+	FCSUnrealType::SerializeFromBinary(Reader);
+	SignatureFunction.SerializeFromBinary(Reader);
+	SignatureFunction.Name = "";
 }
\ No newline at end of file
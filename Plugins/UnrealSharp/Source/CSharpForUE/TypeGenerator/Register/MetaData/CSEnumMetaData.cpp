@@ -1,4 +1,5 @@
 ﻿#include "CSEnumMetaData.h"
+#include "TypeGenerator/Register/CSMetaDataReader.h"
 
 void FCSEnumMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
 {
@@ -12,4 +13,16 @@ void FCSEnumMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObjec
 			Items.Add(*Item->AsString());
 		}
 	}
+}
+
+void FCSEnumMetaData::SerializeFromBinary(FCSMetaDataReader& Reader)
+{
+	FCSTypeReferenceMetaData::SerializeFromBinary(Reader);
+
+	const int32 NumItems = Reader.ReadCount();
+	Items.Reserve(NumItems);
+	for (int32 i = 0; i < NumItems; ++i)
+	{
+		Items.Add(Reader.ReadName());
+	}
 }
\ No newline at end of file
@@ -10,5 +10,6 @@ struct FCSEnumMetaData : public FCSTypeReferenceMetaData
 
 	//FTypeMetaData interface implementation
 	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject) override;
+	virtual void SerializeFromBinary(FCSMetaDataReader& Reader) override;
 	//End of implementation
 };
@@ -1,7 +1,14 @@
 ﻿#include "CSEnumPropertyMetaData.h"
+#include "TypeGenerator/Register/CSMetaDataReader.h"
 
 void FCSEnumPropertyMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
 {
 	FCSUnrealType::SerializeFromJson(JsonObject);
 	InnerProperty.SerializeFromJson(JsonObject->GetObjectField(TEXT("InnerProperty")));
+}
+
+void FCSEnumPropertyMetaData::SerializeFromBinary(FCSMetaDataReader& Reader)
+{
+	FCSUnrealType::SerializeFromBinary(Reader);
+	InnerProperty.SerializeFromBinary(Reader);
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 ﻿#include "CSFunctionMetaData.h"
 
 #include "TypeGenerator/Register/CSMetaDataUtils.h"
+#include "TypeGenerator/Register/CSMetaDataReader.h"
 
 void FCSFunctionMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
 {
@@ -22,5 +23,22 @@ void FCSFunctionMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonO
 	}
 
 	JsonObject->TryGetBoolField(TEXT("IsVirtual"), IsVirtual);
+	JsonObject->TryGetBoolField(TEXT("HasNativeEntryPoint"), HasNativeEntryPoint);
 	FunctionFlags = FCSMetaDataUtils::GetFlags<EFunctionFlags>(JsonObject,"FunctionFlags");
 }
+
+void FCSFunctionMetaData::SerializeFromBinary(FCSMetaDataReader& Reader)
+{
+	FCSMemberMetaData::SerializeFromBinary(Reader);
+
+	FCSMetaDataUtils::SerializeProperties(Reader, Parameters);
+
+	if (Reader.ReadBool())
+	{
+		FCSMetaDataUtils::SerializeProperty(Reader, ReturnValue);
+		ReturnValue.Name = "ReturnValue";
+	}
+
+	FunctionFlags = Reader.ReadFlags<EFunctionFlags>();
+	HasNativeEntryPoint = Reader.ReadBool();
+}
@@ -10,9 +10,11 @@ struct FCSFunctionMetaData : FCSMemberMetaData
 	TArray<FCSPropertyMetaData> Parameters;
 	FCSPropertyMetaData ReturnValue;
 	bool IsVirtual = false;
+	bool HasNativeEntryPoint = false;
 	EFunctionFlags FunctionFlags;
 
 	//FTypeMetaData interface implementation
 	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject) override;
+	virtual void SerializeFromBinary(FCSMetaDataReader& Reader) override;
 	//End of implementation
 };
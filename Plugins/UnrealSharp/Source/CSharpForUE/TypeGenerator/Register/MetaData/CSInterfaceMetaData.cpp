@@ -1,9 +1,16 @@
 ﻿#include "CSInterfaceMetaData.h"
 
 #include "TypeGenerator/Register/CSMetaDataUtils.h"
+#include "TypeGenerator/Register/CSMetaDataReader.h"
 
 void FCSInterfaceMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
 {
 	FCSTypeReferenceMetaData::SerializeFromJson(JsonObject);
 	FCSMetaDataUtils::SerializeFunctions(JsonObject->GetArrayField(TEXT("Functions")), Functions);
 }
+
+void FCSInterfaceMetaData::SerializeFromBinary(FCSMetaDataReader& Reader)
+{
+	FCSTypeReferenceMetaData::SerializeFromBinary(Reader);
+	FCSMetaDataUtils::SerializeFunctions(Reader, Functions);
+}
@@ -1,6 +1,7 @@
 ﻿#include "CSMapPropertyMetaData.h"
 
 #include "TypeGenerator/Register/CSMetaDataUtils.h"
+#include "TypeGenerator/Register/CSMetaDataReader.h"
 
 void FCSMapPropertyMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
 {
@@ -8,3 +9,10 @@ void FCSMapPropertyMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& Js
 	FCSMetaDataUtils::SerializeProperty(JsonObject->GetObjectField(TEXT("InnerProperty")), KeyType);
 	FCSMetaDataUtils::SerializeProperty(JsonObject->GetObjectField(TEXT("ValueProperty")), ValueType);
 }
+
+void FCSMapPropertyMetaData::SerializeFromBinary(FCSMetaDataReader& Reader)
+{
+	FCSUnrealType::SerializeFromBinary(Reader);
+	FCSMetaDataUtils::SerializeProperty(Reader, KeyType);
+	FCSMetaDataUtils::SerializeProperty(Reader, ValueType);
+}
@@ -10,5 +10,6 @@ struct FCSMapPropertyMetaData : public FCSUnrealType
 
 	// FTypeMetaData interface implementation
 	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject) override;
+	virtual void SerializeFromBinary(FCSMetaDataReader& Reader) override;
 	// End of implementation
 };
@@ -1,4 +1,5 @@
 ﻿#include "CSMemberMetaData.h"
+#include "TypeGenerator/Register/CSMetaDataReader.h"
 #include "TypeGenerator/Register/CSMetaDataUtils.h"
 
 void FCSMemberMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
@@ -6,3 +7,9 @@ void FCSMemberMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObj
 	Name = *JsonObject->GetStringField(TEXT("Name"));
 	FCSMetaDataUtils::SerializeFromJson(JsonObject, MetaData);
 }
+
+void FCSMemberMetaData::SerializeFromBinary(FCSMetaDataReader& Reader)
+{
+	Name = Reader.ReadName();
+	Reader.ReadMetaDataMap(MetaData);
+}
@@ -1,5 +1,7 @@
 ﻿#pragma once
 
+class FCSMetaDataReader;
+
 struct FCSMemberMetaData
 {
 	virtual ~FCSMemberMetaData() = default;
@@ -8,4 +10,5 @@ struct FCSMemberMetaData
 	TMap<FString, FString> MetaData;
 	
 	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject);;
+	virtual void SerializeFromBinary(FCSMetaDataReader& Reader);
 };
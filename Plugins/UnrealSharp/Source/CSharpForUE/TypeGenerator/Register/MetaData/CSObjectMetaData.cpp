@@ -1,7 +1,14 @@
 ﻿#include "CSObjectMetaData.h"
+#include "TypeGenerator/Register/CSMetaDataReader.h"
 
 void FCSObjectMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
 {
 	FCSUnrealType::SerializeFromJson(JsonObject);
 	InnerType.SerializeFromJson(JsonObject->GetObjectField(TEXT("InnerType")));
+}
+
+void FCSObjectMetaData::SerializeFromBinary(FCSMetaDataReader& Reader)
+{
+	FCSUnrealType::SerializeFromBinary(Reader);
+	InnerType.SerializeFromBinary(Reader);
 }
\ No newline at end of file
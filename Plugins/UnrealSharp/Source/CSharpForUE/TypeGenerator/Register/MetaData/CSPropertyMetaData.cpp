@@ -1,4 +1,5 @@
 ﻿#include "CSPropertyMetaData.h"
+#include "TypeGenerator/Register/CSMetaDataReader.h"
 #include "TypeGenerator/Register/CSMetaDataUtils.h"
 
 void FCSPropertyMetaData:: SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
@@ -18,3 +19,16 @@ void FCSPropertyMetaData:: SerializeFromJson(const TSharedPtr<FJsonObject>& Json
 		RepNotifyFunctionName = *RepNotifyFunctionNameStr;
 	}
 }
+
+void FCSPropertyMetaData::SerializeFromBinary(FCSMetaDataReader& Reader)
+{
+	FCSMemberMetaData::SerializeFromBinary(Reader);
+
+	PropertyFlags = Reader.ReadFlags<EPropertyFlags>();
+	LifetimeCondition = Reader.ReadFlags<ELifetimeCondition>();
+	
+	BlueprintGetter = Reader.ReadString();
+	BlueprintSetter = Reader.ReadString();
+	IsArray = Reader.ReadBool();
+	RepNotifyFunctionName = Reader.ReadName();
+}
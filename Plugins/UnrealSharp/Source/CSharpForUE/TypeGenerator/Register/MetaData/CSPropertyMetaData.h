@@ -19,6 +19,7 @@ struct FCSPropertyMetaData : FCSMemberMetaData
 
 	//FTypeMetaData interface implementation
 	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject) override;
+	virtual void SerializeFromBinary(FCSMetaDataReader& Reader) override;
 	//End of implementation
 
 	template<typename T>
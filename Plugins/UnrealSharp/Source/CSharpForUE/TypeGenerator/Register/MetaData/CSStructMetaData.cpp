@@ -1,4 +1,6 @@
 ﻿#include "CSStructMetaData.h"
+#include "TypeGenerator/Register/CSMetaDataReader.h"
+#include "TypeGenerator/Register/CSMetaDataUtils.h"
 
 void FCSStructMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
 {
@@ -8,4 +10,10 @@ void FCSStructMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObj
 	{
 		FCSMetaDataUtils::SerializeProperties(*FoundProperties, Properties);
 	}
+}
+
+void FCSStructMetaData::SerializeFromBinary(FCSMetaDataReader& Reader)
+{
+	FCSTypeReferenceMetaData::SerializeFromBinary(Reader);
+	FCSMetaDataUtils::SerializeProperties(Reader, Properties);
 }
\ No newline at end of file
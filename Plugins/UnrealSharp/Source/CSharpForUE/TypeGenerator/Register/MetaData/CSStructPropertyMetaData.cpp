@@ -1,7 +1,14 @@
 ﻿#include "CSStructPropertyMetaData.h"
+#include "TypeGenerator/Register/CSMetaDataReader.h"
 
 void FCSStructPropertyMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
 {
 	FCSUnrealType::SerializeFromJson(JsonObject);
 	TypeRef.SerializeFromJson(JsonObject->GetObjectField(TEXT("InnerType")));
+}
+
+void FCSStructPropertyMetaData::SerializeFromBinary(FCSMetaDataReader& Reader)
+{
+	FCSUnrealType::SerializeFromBinary(Reader);
+	TypeRef.SerializeFromBinary(Reader);
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 ﻿#include "CSTypeReferenceMetaData.h"
 
 #include "TypeGenerator/Register/CSMetaDataUtils.h"
+#include "TypeGenerator/Register/CSMetaDataReader.h"
 
 void FCSTypeReferenceMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
 {
@@ -20,3 +21,11 @@ void FCSTypeReferenceMetaData::SerializeFromJson(const TSharedPtr<FJsonObject>&
 	
 	FCSMetaDataUtils::SerializeFromJson(JsonObject, MetaData);
 }
+
+void FCSTypeReferenceMetaData::SerializeFromBinary(FCSMetaDataReader& Reader)
+{
+	Name = Reader.ReadName();
+	Namespace = Reader.ReadName();
+	AssemblyName = Reader.ReadName();
+	Reader.ReadMetaDataMap(MetaData);
+}
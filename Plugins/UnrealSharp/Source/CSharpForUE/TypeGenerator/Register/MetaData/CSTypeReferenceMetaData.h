@@ -1,5 +1,7 @@
 ﻿#pragma once
 
+class FCSMetaDataReader;
+
 struct FCSTypeReferenceMetaData
 {
 	virtual ~FCSTypeReferenceMetaData() = default;
@@ -11,4 +13,5 @@ struct FCSTypeReferenceMetaData
 	TMap<FString, FString> MetaData;
 	
 	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject);
+	virtual void SerializeFromBinary(FCSMetaDataReader& Reader);
 };
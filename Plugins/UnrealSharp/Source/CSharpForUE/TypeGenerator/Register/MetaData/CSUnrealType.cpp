@@ -1,6 +1,7 @@
 ﻿#include "CSUnrealType.h"
 
 #include "TypeGenerator/Register/CSMetaDataUtils.h"
+#include "TypeGenerator/Register/CSMetaDataReader.h"
 
 void FCSUnrealType::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
 {
@@ -10,3 +11,9 @@ void FCSUnrealType::SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject)
 		PropertyType = static_cast<ECSPropertyType>(JsonObject->GetIntegerField(TEXT("PropertyType")));
 	}
 }
+
+void FCSUnrealType::SerializeFromBinary(FCSMetaDataReader& Reader)
+{
+	// PropertyType is read by CSMetaDataFactory, since it decides which metadata type gets created.
+	ArrayDim = Reader.ReadInt32();
+}
@@ -1,5 +1,7 @@
 ﻿#pragma once
 
+class FCSMetaDataReader;
+
 #include "CSPropertyType.h"
 
 struct FCSUnrealType
@@ -12,6 +14,7 @@ struct FCSUnrealType
 
 	// Begin FCSUnrealType
 	virtual void SerializeFromJson(const TSharedPtr<FJsonObject>& JsonObject);
+	virtual void SerializeFromBinary(FCSMetaDataReader& Reader);
 	virtual void OnPropertyCreated(FProperty* Property) {};
 	// End FCSUnrealType
 };
@@ -6,17 +6,14 @@
 
 struct CSHARPFORUE_API FCSharpClassInfo : TCSharpTypeInfo<FCSClassMetaData, UClass, FCSGeneratedClassBuilder>
 {
-	FCSharpClassInfo(const TSharedPtr<FJsonValue>& MetaData) : TCSharpTypeInfo(MetaData)
-	{
-		TypeHandle = FCSManager::Get().GetTypeHandle(*TypeMetaData);
-	}
-	
+	FCSharpClassInfo(const TSharedPtr<FJsonValue>& MetaData) : TCSharpTypeInfo(MetaData) {}
+	FCSharpClassInfo(FCSMetaDataReader& Reader) : TCSharpTypeInfo(Reader) {}
 	FCSharpClassInfo() {};
 
 	// TCharpTypeInfo interface implementation
 	virtual UClass* InitializeBuilder() override;
 	// End of implementation
 	
-	// Pointer to the TypeHandle in CSharp
-	uint8* TypeHandle;
+	// Pointer to the TypeHandle in CSharp. Looked up by FCSTypeRegistry on the game thread once the metadata is parsed.
+	uint8* TypeHandle = nullptr;
 };
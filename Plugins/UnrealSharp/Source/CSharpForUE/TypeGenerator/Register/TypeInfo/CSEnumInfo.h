@@ -7,5 +7,6 @@
 struct CSHARPFORUE_API FCSharpEnumInfo : TCSharpTypeInfo<FCSEnumMetaData, UEnum, FCSGeneratedEnumBuilder>
 {
 	FCSharpEnumInfo(const TSharedPtr<FJsonValue>& MetaData) : TCSharpTypeInfo(MetaData) {}
+	FCSharpEnumInfo(FCSMetaDataReader& Reader) : TCSharpTypeInfo(Reader) {}
 	FCSharpEnumInfo() {};
 };
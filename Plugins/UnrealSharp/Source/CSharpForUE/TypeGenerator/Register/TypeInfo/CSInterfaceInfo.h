@@ -8,6 +8,7 @@ class FCSGeneratedInterfaceBuilder;
 struct CSHARPFORUE_API FCSharpInterfaceInfo : TCSharpTypeInfo<FCSInterfaceMetaData, UClass, FCSGeneratedInterfaceBuilder>
 {
 	FCSharpInterfaceInfo(const TSharedPtr<FJsonValue>& MetaData) : TCSharpTypeInfo(MetaData) {}
+	FCSharpInterfaceInfo(FCSMetaDataReader& Reader) : TCSharpTypeInfo(Reader) {}
 	FCSharpInterfaceInfo() {};
 };
 
@@ -8,5 +8,6 @@ class FCSGeneratedStructBuilder;
 struct CSHARPFORUE_API FCSharpStructInfo : TCSharpTypeInfo<FCSStructMetaData, UScriptStruct, FCSGeneratedStructBuilder>
 {
 	FCSharpStructInfo(const TSharedPtr<FJsonValue>& MetaData) : TCSharpTypeInfo(MetaData) {}
+	FCSharpStructInfo(FCSMetaDataReader& Reader) : TCSharpTypeInfo(Reader) {}
 	FCSharpStructInfo() {};
 };
@@ -1,5 +1,7 @@
 ﻿#pragma once
 
+class FCSMetaDataReader;
+
 template<typename TMetaData, typename TField, typename TTypeBuilder>
 struct CSHARPFORUE_API TCSharpTypeInfo
 {
@@ -11,6 +13,16 @@ struct CSHARPFORUE_API TCSharpTypeInfo
 		TypeMetaData->SerializeFromJson(MetaData->AsObject());
 	}
 
+	TCSharpTypeInfo(FCSMetaDataReader& Reader) : TypeMetaData(nullptr), Field(nullptr)
+	{
+		TypeMetaData = MakeShared<TMetaData>();
+		
+		Reader.ResetContentHash();
+		TypeMetaData->SerializeFromBinary(Reader);
+		ContentHash = Reader.GetContentHash();
+		ReferencedNames = Reader.ConsumeReferencedNames();
+	}
+
 	TCSharpTypeInfo() : Field(nullptr) {}
 	
 	// The meta data for this type (properties, functions et.c.)
@@ -19,6 +31,12 @@ struct CSHARPFORUE_API TCSharpTypeInfo
 	// Pointer to the field of this type
 	TField* Field;
 
+	// Hash of the type's binary metadata, used to find the types that didn't change on hot reload. Zero if unknown.
+	uint64 ContentHash = 0;
+
+	// Names found in the type's metadata. Includes every type it references.
+	TArray<FName> ReferencedNames;
+
 	virtual TField* InitializeBuilder()
 	{
 		if (Field)
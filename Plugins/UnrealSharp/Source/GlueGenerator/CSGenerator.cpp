@@ -16,6 +16,15 @@
 #include "UnrealSharpUtilities/UnrealSharpStatics.h"
 #include "Kismet/BlueprintAsyncActionBase.h"
 #include "UObject/Field.h"
+#include "Async/ParallelFor.h"
+#include "Misc/ScopeLock.h"
+#include "Misc/ScopeRWLock.h"
+
+namespace
+{
+	// The types force-exported while building the glue of the type this thread is exporting.
+	thread_local TArray<UObject*>* ForcedReferences = nullptr;
+}
 
 void FCSGenerator::StartGenerator(const FString& OutputDirectory)
 {
@@ -28,6 +37,7 @@ void FCSGenerator::StartGenerator(const FString& OutputDirectory)
 	GeneratedScriptsDirectory = OutputDirectory;
 
 	CheckGlueGeneratorVersion();
+	GlueManifest.Load(FPaths::Combine(GeneratedScriptsDirectory, TEXT("GlueManifest.bin")));
 
 	//TODO: SUPPORT THESE BUT CURRENTLY TOO LAZY TO FIX
 	{
@@ -49,32 +59,107 @@ void FCSGenerator::StartGenerator(const FString& OutputDirectory)
 
 	FModuleManager::Get().OnModulesChanged().AddRaw(this, &FCSGenerator::OnModulesChanged);
 
-	// Get all currently loaded types that are in the engine
-	TArray<UObject*> PackagesToProcess;
-	GetObjectsOfClass(UPackage::StaticClass(), PackagesToProcess);
-	for (UObject* ObjectToProcess : PackagesToProcess)
+	GenerateGlueForLoadedPackages();
+}
+
+double FCSGenerator::RegenerateAllGlue(bool bUseManifest)
+{
+	if (!ensureMsgf(bInitialized, TEXT("The glue generator has to be started before glue can be regenerated.")))
+	{
+		return 0.0;
+	}
+	
 	{
-		GenerateGlueForPackage(static_cast<UPackage*>(ObjectToProcess));
+		FScopeLock Lock(&ExportLock);
+		ExportedTypes.Reset();
+		ExportedDelegates.Reset();
+		ExtensionMethods.Reset();
 	}
 
+	if (!bUseManifest)
+	{
+		GlueManifest.Reset();
+	}
+
+	return GenerateGlueForLoadedPackages();
+}
+
+double FCSGenerator::GenerateGlueForLoadedPackages()
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Get all currently loaded types that are in the engine
+	TArray<UPackage*> PackagesToProcess;
+	ForEachObjectOfClass(UPackage::StaticClass(), [&PackagesToProcess](UObject* Object)
+	{
+		PackagesToProcess.Add(static_cast<UPackage*>(Object));
+	});
+	
+	GenerateGlueForPackages(PackagesToProcess);
+
 	// Generate glue for some common types that don't get picked up.
 	GenerateGlueForType(UInterface::StaticClass(), true);
 	GenerateGlueForType(UObject::StaticClass(), true);
 	GenerateGlueForType(USpringArmComponent::StaticClass(), true);
 	GenerateGlueForType(UFloatingPawnMovement::StaticClass(), true);
+
+	// Every loaded type has been through the generator now, so whatever it didn't touch in a loaded package is gone.
+	GlueManifest.PruneUnusedEntries();
+	GlueManifest.Save();
+
+	const double GenerationTime = FPlatformTime::Seconds() - StartTime;
+	UE_LOG(LogGlueGenerator, Display, TEXT("Generated C# glue for %d packages in %.2f seconds."), PackagesToProcess.Num(), GenerationTime);
+	return GenerationTime;
 }
 
-void FCSGenerator::GenerateGlueForPackage(const UPackage* Package)
+void FCSGenerator::GenerateGlueForPackage(UPackage* Package)
 {
-	TArray<UObject*> ObjectsToProcess;
-	GetObjectsWithPackage(Package, ObjectsToProcess, false, RF_ClassDefaultObject);
+	GenerateGlueForPackages({ Package });
+}
 
-	for (UObject* ObjectToProcess : ObjectsToProcess)
+void FCSGenerator::GenerateGlueForPackages(const TArray<UPackage*>& Packages)
+{
+	PropertyTranslatorManager->ResetCaches();
+	
+	TArray<UObject*> ObjectsToProcess;
+	
+	for (UPackage* Package : Packages)
 	{
-		GenerateGlueForType(ObjectToProcess);
+		if (Package == GetTransientPackage())
+		{
+			continue;
+		}
+		
+		// Registering the modules up front keeps the worker threads on the read lock.
+		FindOrRegisterModule(Package);
+
+#if WITH_EDITORONLY_DATA
+		// Package metadata is created on first access, which has to happen on the game thread.
+		Package->GetMetaData();
+#endif
+		
+		GetObjectsWithPackage(Package, ObjectsToProcess, false, RF_ClassDefaultObject);
 	}
 
-	GenerateExtensionMethodsForPackage(Package);
+	// Building the glue only reads reflection data, so each type can be exported independently.
+	// Referenced types are exported on whichever thread reaches them first.
+	bDeferSaving = true;
+	ParallelFor(ObjectsToProcess.Num(), [this, &ObjectsToProcess](int32 Index)
+	{
+		GenerateGlueForType(ObjectsToProcess[Index]);
+	}, EParallelForFlags::Unbalanced);
+	bDeferSaving = false;
+
+	CommitPendingGlue();
+
+	// Extension methods are gathered while exporting the function libraries, so they can only be written once all types are done.
+	for (const UPackage* Package : Packages)
+	{
+		if (Package != GetTransientPackage())
+		{
+			GenerateExtensionMethodsForPackage(Package);
+		}
+	}
 }
 
 void FCSGenerator::OnModulesChanged(FName InModuleName, EModuleChangeReason InModuleChangeReason)
@@ -84,7 +169,7 @@ void FCSGenerator::OnModulesChanged(FName InModuleName, EModuleChangeReason InMo
 		return;
 	}
 	
-	const UPackage* ModulePackage = FindPackage(nullptr, *FString::Printf(TEXT("/Script/%s"), *InModuleName.ToString()));
+	UPackage* ModulePackage = FindPackage(nullptr, *FString::Printf(TEXT("/Script/%s"), *InModuleName.ToString()));
 	
 	if (!ModulePackage)
 	{
@@ -92,6 +177,7 @@ void FCSGenerator::OnModulesChanged(FName InModuleName, EModuleChangeReason InMo
 	}
 
 	GenerateGlueForPackage(ModulePackage);
+	GlueManifest.Save();
 }
 
 #define LOCTEXT_NAMESPACE "FScriptGenerator"
@@ -117,12 +203,22 @@ void FCSGenerator::GenerateGlueForType(UObject* Object, bool bForceExport)
 	{
 		return;
 	}
+
+	// Recorded even if it's already exported, so the referencing type can export it again when it's kept from the manifest.
+	if (bForceExport && ForcedReferences)
+	{
+		ForcedReferences->AddUnique(Object);
+	}
 	
-	if (ExportedTypes.Contains(Object))
+	if (IsTypeExported(Object))
 	{
 		return;
 	}
 
+	TArray<UObject*> References;
+	TGuardValue<TArray<UObject*>*> ReferencesGuard(ForcedReferences, &References);
+
+	uint32 TypeHash = 0;
 	FCSScriptBuilder Builder(FCSScriptBuilder::IndentType::Spaces);
 	
 	if (UClass* Class = Cast<UClass>(Object))
@@ -163,26 +259,37 @@ void FCSGenerator::GenerateGlueForType(UObject* Object, bool bForceExport)
 		}
 		
 		RegisterClassToModule(Class);
+
+		const bool bIsInterface = Class->IsChildOf(UInterface::StaticClass());
+		if (!bIsInterface && !bForceExport && !ShouldExportClass(Class))
+		{
+			return;
+		}
+
+		if (TryKeepExistingGlue(Class, TypeHash))
+		{
+			return;
+		}
 				
-		if (Class->IsChildOf(UInterface::StaticClass()))
+		if (bIsInterface)
 		{
 			ExportInterface(Class, Builder);
 		}
-		else if (bForceExport || ShouldExportClass(Class))
+		else
 		{
 			ExportClass(Class, Builder);
 		}
 	}
 	else if (UScriptStruct* Struct = Cast<UScriptStruct>(Object))
 	{
-		if (bForceExport || ShouldExportStruct(Struct))
+		if ((bForceExport || ShouldExportStruct(Struct)) && TryAddExportedType(Struct) && !TryKeepExistingGlue(Struct, TypeHash))
 		{
 			ExportStruct(Struct, Builder);
 		}
 	}
 	else if (UEnum* Enum = Cast<UEnum>(Object))
 	{
-		if (bForceExport || ShouldExportEnum(Enum))
+		if ((bForceExport || ShouldExportEnum(Enum)) && TryAddExportedType(Enum) && !TryKeepExistingGlue(Enum, TypeHash))
 		{
 			ExportEnum(Enum, Builder);
 		}
@@ -194,6 +301,57 @@ void FCSGenerator::GenerateGlueForType(UObject* Object, bool bForceExport)
 	}
 	
 	SaveTypeGlue(Object->GetOutermost(), Object->GetName(), Builder);
+
+	TArray<FString> ReferencePaths;
+	ReferencePaths.Reserve(References.Num());
+	for (const UObject* Reference : References)
+	{
+		ReferencePaths.Add(Reference->GetPathName());
+	}
+	
+	GlueManifest.Update(Object, TypeHash, GetTypeGluePath(Object), MoveTemp(ReferencePaths));
+}
+
+bool FCSGenerator::TryKeepExistingGlue(UObject* Type, uint32& OutTypeHash)
+{
+	OutTypeHash = FCSGlueManifest::HashType(Type);
+
+	// Extension methods are gathered while exporting function libraries, so those always have to be exported.
+	const UClass* Class = Cast<UClass>(Type);
+	if (Class && Class->IsChildOf(UBlueprintFunctionLibrary::StaticClass()))
+	{
+		return false;
+	}
+
+	if (!GlueManifest.IsUpToDate(Type, OutTypeHash))
+	{
+		return false;
+	}
+
+	// Only a stat, instead of reading the whole file like SaveFileIfChanged does.
+	if (!IFileManager::Get().FileExists(*GetTypeGluePath(Type)))
+	{
+		return false;
+	}
+
+	TryAddExportedType(Type);
+
+	// Types that are only exported because something references them would otherwise be pruned.
+	for (const FString& ReferencePath : GlueManifest.GetReferences(Type))
+	{
+		if (UObject* Reference = FindObject<UObject>(nullptr, *ReferencePath))
+		{
+			GenerateGlueForType(Reference, true);
+		}
+	}
+	
+	return true;
+}
+
+FString FCSGenerator::GetTypeGluePath(const UObject* Type)
+{
+	const FCSModule& Module = FindOrRegisterModule(Type->GetOutermost());
+	return FPaths::Combine(Module.GetGeneratedSourceDirectory(), FString::Printf(TEXT("%s.generated.cs"), *Type->GetName()));
 }
 
 void FCSGenerator::GenerateGlueForDelegate(UFunction* DelegateSignature, bool bForceExport)
@@ -204,9 +362,12 @@ void FCSGenerator::GenerateGlueForDelegate(UFunction* DelegateSignature, bool bF
 		return;
 	}
 
-	if (ExportedDelegates.Contains(DelegateSignature))
 	{
-		return;
+		FScopeLock Lock(&ExportLock);
+		if (ExportedDelegates.Contains(DelegateSignature))
+		{
+			return;
+		}
 	}
 
 	FCSScriptBuilder Builder(FCSScriptBuilder::IndentType::Spaces);
@@ -222,7 +383,7 @@ void FCSGenerator::GenerateGlueForDelegate(UFunction* DelegateSignature, bool bF
 	FString DelegateName = FDelegateBasePropertyTranslator::GetDelegateName(DelegateSignature);
 
 	FString FileName = FString::Printf(TEXT("%s.generated.cs"), *DelegateName);
-	Get().SaveGlue(Module, FileName, Builder.ToString());
+	Get().SaveGlue(Module, FileName, Builder);
 }
 
 void FCSGenerator::GenerateExtensionMethodsForPackage(const UPackage* Package)
@@ -230,6 +391,12 @@ void FCSGenerator::GenerateExtensionMethodsForPackage(const UPackage* Package)
 	FCSModule& Module = FindOrRegisterModule(Package);
 	if (TArray<ExtensionMethod>* FoundExtensionMethods = ExtensionMethods.Find(Module.GetModuleName()))
 	{
+		// Function libraries are exported in parallel, so sort to keep the file stable between runs.
+		FoundExtensionMethods->Sort([](const ExtensionMethod& A, const ExtensionMethod& B)
+		{
+			return A.Function->GetPathName() < B.Function->GetPathName();
+		});
+		
 		FCSScriptBuilder Builder(FCSScriptBuilder::IndentType::Spaces);
 		FString ClassName = FString::Printf(TEXT("%sExtensions"), *Module.GetModuleName().ToString());
 		Builder.GenerateScriptSkeleton(Module.GetNamespace());
@@ -333,7 +500,7 @@ void FCSGenerator::ExportEnum(UEnum* Enum, FCSScriptBuilder& Builder)
 
 
 		AppendTooltip(Enum->GetToolTipTextByIndex(i), Builder);
-		Builder.AppendLine(FString::Printf(TEXT("%s=%lld,"), *RawName, Value));
+		Builder.AppendLinef(TEXT("%s=%lld,"), *RawName, Value);
 	}
 
 	Builder.CloseBrace();
@@ -566,65 +733,73 @@ void FCSGenerator::RegisterClassToModule(const UObject* Struct)
 FCSModule& FCSGenerator::FindOrRegisterModule(const UObject* Struct)
 {
 	const FName ModuleName = UUnrealSharpStatics::GetModuleName(Struct);
-	FCSModule* BindingsModule = CSharpBindingsModules.Find(ModuleName);
-    
-	if (!BindingsModule)
+	
+	{
+		FReadScopeLock ReadLock(ModulesLock);
+		if (const TUniquePtr<FCSModule>* BindingsModule = CSharpBindingsModules.Find(ModuleName))
+		{
+			return **BindingsModule;
+		}
+	}
+
+	FWriteScopeLock WriteLock(ModulesLock);
+	if (const TUniquePtr<FCSModule>* ExistingModule = CSharpBindingsModules.Find(ModuleName))
 	{
-		FString Directory = TEXT("");
-		FString ProjectDirectory = FPaths::ProjectDir();
-		FString GeneratedUserContent = "Script/obj/Generated";
+		return **ExistingModule;
+	}
 
-		if (TSharedPtr<IPlugin> ThisPlugin = IPluginManager::Get().FindPlugin(UE_PLUGIN_NAME))
+	FString Directory = TEXT("");
+	FString ProjectDirectory = FPaths::ProjectDir();
+	FString GeneratedUserContent = "Script/obj/Generated";
+
+	if (TSharedPtr<IPlugin> ThisPlugin = IPluginManager::Get().FindPlugin(UE_PLUGIN_NAME))
+	{
+		// If this plugin is a project plugin, we want to generate all the bindings in the same directory as the plug-in
+		// since there's no reason to split the project from the plug-in, like you would need to if this was installed
+		// as an engine plugin.
+		if (ThisPlugin->GetType() == EPluginType::Project)
 		{
-			// If this plugin is a project plugin, we want to generate all the bindings in the same directory as the plug-in
-			// since there's no reason to split the project from the plug-in, like you would need to if this was installed
-			// as an engine plugin.
-			if (ThisPlugin->GetType() == EPluginType::Project)
+			Directory = GeneratedScriptsDirectory;
+		}
+		else
+		{
+			if (TSharedPtr<IPlugin> Plugin = IPluginManager::Get().GetModuleOwnerPlugin(*ModuleName.ToString()))
 			{
-				Directory = GeneratedScriptsDirectory;
+				if (Plugin->GetType() == EPluginType::Engine || Plugin->GetType() == EPluginType::Enterprise)
+				{
+					Directory = GeneratedScriptsDirectory;
+				}
+				else
+				{
+					Directory = FPaths::Combine(ProjectDirectory, GeneratedUserContent);
+				}
 			}
 			else
 			{
-				if (TSharedPtr<IPlugin> Plugin = IPluginManager::Get().GetModuleOwnerPlugin(*ModuleName.ToString()))
+				if (IModuleInterface* Module = FModuleManager::Get().GetModule(ModuleName))
 				{
-					if (Plugin->GetType() == EPluginType::Engine || Plugin->GetType() == EPluginType::Enterprise)
+					if (Module->IsGameModule())
 					{
-						Directory = GeneratedScriptsDirectory;
+						Directory = FPaths::Combine(ProjectDirectory, GeneratedUserContent);
 					}
 					else
 					{
-						Directory = FPaths::Combine(ProjectDirectory, GeneratedUserContent);
+						Directory = GeneratedScriptsDirectory;
 					}
 				}
 				else
 				{
-					if (IModuleInterface* Module = FModuleManager::Get().GetModule(ModuleName))
-					{
-						if (Module->IsGameModule())
-						{
-							Directory = FPaths::Combine(ProjectDirectory, GeneratedUserContent);
-						}
-						else
-						{
-							Directory = GeneratedScriptsDirectory;
-						}
-					}
-					else
-					{
-						// This is awful, but we have no way of knowing if the module is a game module or not without loading it.
-						// Also for whatever reason "CoreOnline" is not a module.
-						Directory = GeneratedScriptsDirectory;
-					}
+					// This is awful, but we have no way of knowing if the module is a game module or not without loading it.
+					// Also for whatever reason "CoreOnline" is not a module.
+					Directory = GeneratedScriptsDirectory;
 				}
 			}
 		}
-
-		ensureMsgf(!Directory.IsEmpty(), TEXT("Generating the directory location for generating the scripts for this module failed."));
-
-		BindingsModule = &CSharpBindingsModules.Emplace(ModuleName, FCSModule(ModuleName, Directory));
 	}
 
-	return *BindingsModule;
+	ensureMsgf(!Directory.IsEmpty(), TEXT("Generating the directory location for generating the scripts for this module failed."));
+
+	return *CSharpBindingsModules.Emplace(ModuleName, MakeUnique<FCSModule>(ModuleName, Directory));
 }
 
 void FCSGenerator::CheckGlueGeneratorVersion() const
@@ -647,13 +822,12 @@ void FCSGenerator::CheckGlueGeneratorVersion() const
 
 void FCSGenerator::ExportInterface(UClass* Interface, FCSScriptBuilder& Builder)
 {
-	if (!ensure(!ExportedTypes.Contains(Interface)))
+	// Another thread may have claimed it since GenerateGlueForType checked.
+	if (!TryAddExportedType(Interface))
 	{
 		return;
 	}
 
-	ExportedTypes.Add(Interface);
-
 	FString InterfaceName = NameMapper.GetScriptClassName(Interface);
 	const FCSModule& BindingsModule = FindOrRegisterModule(Interface);
 	
@@ -661,7 +835,7 @@ void FCSGenerator::ExportInterface(UClass* Interface, FCSScriptBuilder& Builder)
 	AppendTooltip(Interface, Builder);
 	Builder.DeclareType("interface", InterfaceName);
 	
-	Builder.AppendLine(FString::Printf(TEXT("public static readonly IntPtr NativeInterfaceClassPtr = UCoreUObjectExporter.CallGetNativeClassFromName(\"%s\");"), *Interface->GetName()));
+	Builder.AppendLinef(TEXT("public static readonly IntPtr NativeInterfaceClassPtr = UCoreUObjectExporter.CallGetNativeClassFromName(\"%s\");"), *Interface->GetName());
 
 	TSet<UFunction*> ExportedFunctions;
 	TSet<UFunction*> ExportedOverridableFunctions;
@@ -672,40 +846,38 @@ void FCSGenerator::ExportInterface(UClass* Interface, FCSScriptBuilder& Builder)
 	Builder.CloseBrace();
 
 	Builder.AppendLine();
-	Builder.AppendLine(FString::Printf(TEXT("public static class %sMarshaller"), *InterfaceName));
+	Builder.AppendLinef(TEXT("public static class %sMarshaller"), *InterfaceName);
 	Builder.OpenBrace();
-	Builder.AppendLine(FString::Printf(TEXT("public static void ToNative(IntPtr nativeBuffer, int arrayIndex, %s obj)"), *InterfaceName));
+	Builder.AppendLinef(TEXT("public static void ToNative(IntPtr nativeBuffer, int arrayIndex, %s obj)"), *InterfaceName);
 	Builder.OpenBrace();
 	Builder.AppendLine("	if (obj is CoreUObject.Object objectPointer)");
 	Builder.AppendLine("	{");
 	Builder.AppendLine("		InterfaceData data = new InterfaceData();");
 	Builder.AppendLine("		data.ObjectPointer = objectPointer.NativeObject;");
-	Builder.AppendLine(FString::Printf(TEXT("		data.InterfacePointer = %s.NativeInterfaceClassPtr;"), *InterfaceName));
+	Builder.AppendLinef(TEXT("		data.InterfacePointer = %s.NativeInterfaceClassPtr;"), *InterfaceName);
 	Builder.AppendLine("		BlittableMarshaller<InterfaceData>.ToNative(nativeBuffer, arrayIndex, data);");
 	Builder.AppendLine("	}");
 	Builder.CloseBrace();
 	Builder.AppendLine();
 
-	Builder.AppendLine(FString::Printf(TEXT("public static %s FromNative(IntPtr nativeBuffer, int arrayIndex)"), *InterfaceName));
+	Builder.AppendLinef(TEXT("public static %s FromNative(IntPtr nativeBuffer, int arrayIndex)"), *InterfaceName);
 	Builder.OpenBrace();
 	Builder.AppendLine("	InterfaceData interfaceData = BlittableMarshaller<InterfaceData>.FromNative(nativeBuffer, arrayIndex);");
 	Builder.AppendLine("	CoreUObject.Object unrealObject = ObjectMarshaller<CoreUObject.Object>.FromNative(interfaceData.ObjectPointer, 0);");
-	Builder.AppendLine(FString::Printf(TEXT("	return unrealObject as %s;"), *InterfaceName));
+	Builder.AppendLinef(TEXT("	return unrealObject as %s;"), *InterfaceName);
 	Builder.CloseBrace();
 	Builder.CloseBrace();
 }
 
 void FCSGenerator::ExportDelegate(UFunction* SignatureFunction, FCSScriptBuilder& Builder)
 {
-	if (!ensure(!ExportedDelegates.Contains(SignatureFunction)))
+	if (!TryAddExportedDelegate(SignatureFunction))
 	{
 		return;
 	}
 
 	ensure(SignatureFunction->HasAnyFunctionFlags(FUNC_Delegate));
 
-	ExportedDelegates.Add(SignatureFunction);
-
 	FCSModule& Module = FCSGenerator::Get().FindOrRegisterModule(SignatureFunction->GetOutermost());
 	FString DelegateName = FDelegateBasePropertyTranslator::GetDelegateName(SignatureFunction);
 
@@ -738,13 +910,12 @@ void FCSGenerator::ExportDelegate(UFunction* SignatureFunction, FCSScriptBuilder
 
 void FCSGenerator::ExportClass(UClass* Class, FCSScriptBuilder& Builder)
 {
-	if (!ensure(!ExportedTypes.Contains(Class)))
+	// Another thread may have claimed it since GenerateGlueForType checked.
+	if (!TryAddExportedType(Class))
 	{
 		return;
 	}
 
-	ExportedTypes.Add(Class);
-
 	Builder.AppendLine(TEXT("// This file is automatically generated"));
 	
 	UClass* SuperClass = Class->GetSuperClass();
@@ -782,7 +953,7 @@ void FCSGenerator::ExportClass(UClass* Class, FCSScriptBuilder& Builder)
 	Builder.GenerateScriptSkeleton(BindingsModule.GetNamespace());
 	AppendTooltip(Class, Builder);
 	FString Abstract = Class->HasAnyClassFlags(CLASS_Abstract) ? "ClassFlags.Abstract" : "";
-	Builder.AppendLine(FString::Printf(TEXT("[UClass(%s)]"), *Abstract));
+	Builder.AppendLinef(TEXT("[UClass(%s)]"), *Abstract);
 	Builder.DeclareType("class", ScriptClassName, GetSuperClassName(Class), true, Interfaces);
 
 	TSet<FString> ReservedNames;
@@ -836,6 +1007,7 @@ void FCSGenerator::ExportClassFunctions(FCSScriptBuilder& Builder, const UClass*
 			if (GetExtensionMethodInfo(Method, Function))
 			{
 				const FCSModule& BindingsModule = FindOrRegisterModule(Class);
+				FScopeLock Lock(&ExportLock);
 				TArray<ExtensionMethod>& ModuleExtensionMethods = ExtensionMethods.FindOrAdd(BindingsModule.GetModuleName());
 				ModuleExtensionMethods.Add(Method);
 			}
@@ -899,14 +1071,36 @@ void FCSGenerator::ExportStaticConstructor(FCSScriptBuilder& Builder, const UStr
 
 	FString TypeName = NameMapper.GetTypeScriptName(Struct);
 	
-	Builder.AppendLine(FString::Printf(TEXT("static %s()"), *TypeName));
+	Builder.AppendLinef(TEXT("static %s()"), *TypeName);
 	Builder.OpenBrace();
 
-	Builder.AppendLine(FString::Printf(TEXT("%sNativeClassPtr = %s.CallGetNative%sFromName(\"%s\");"),
+	Builder.AppendLinef(TEXT("%sNativeClassPtr = %s.CallGetNative%sFromName(\"%s\");"),
 		bHasStaticFunctions ? TEXT("") : TEXT("IntPtr "),
 		CoreUObjectCallbacks,
 		Class ? TEXT("Class") : TEXT("Struct"), 
-		*Struct->GetName()));
+		*Struct->GetName());
+
+	// Everything below reads from NativeLayout, so collect every name it will ask for and resolve them all in one call.
+	TArray<FString> LayoutNames;
+	for (const FProperty* Property : ExportedProperties)
+	{
+		LayoutNames.Add(Property->GetName());
+	}
+
+	for (const UFunction* Function : ExportedFunctions)
+	{
+		AddFunctionLayoutNames(LayoutNames, Function);
+	}
+
+	for (const UFunction* Function : ExportedOverrideableFunctions)
+	{
+		if (Function->NumParms > 0)
+		{
+			AddFunctionLayoutNames(LayoutNames, Function);
+		}
+	}
+
+	ExportTypeLayoutResolution(Builder, TEXT("NativeClassPtr"), LayoutNames);
 
 	Builder.AppendLine();
 
@@ -923,7 +1117,7 @@ void FCSGenerator::ExportStaticConstructor(FCSScriptBuilder& Builder, const UStr
 	else
 	{
 		Builder.AppendLine();
-		Builder.AppendLine(FString::Printf(TEXT("NativeDataSize = %s.CallGetNativeStructSize(NativeClassPtr);"), UScriptStructCallbacks));
+		Builder.AppendLinef(TEXT("NativeDataSize = %s.CallGetNativeStructSize(NativeClassPtr);"), UScriptStructCallbacks);
 	}
 
 	Builder.CloseBrace();
@@ -946,8 +1140,7 @@ void FCSGenerator::ExportClassOverridableFunctionsStaticConstruction(FCSScriptBu
 		}
 		
 		FString NativeMethodName = Function->GetName();
-		Builder.AppendLine(FString::Printf(TEXT("IntPtr %s_NativeFunction = %s.CallGetNativeFunctionFromClassAndName(NativeClassPtr, \"%s\");"), *NativeMethodName, UClassCallbacks, *NativeMethodName));
-		Builder.AppendLine(FString::Printf(TEXT("%s_ParamsSize = %s.CallGetNativeFunctionParamsSize(%s_NativeFunction);"), *NativeMethodName, UFunctionCallbacks, *NativeMethodName));
+		Builder.AppendLinef(TEXT("%s_ParamsSize = NativeLayout.GetParamsSize(\"%s\");"), *NativeMethodName, *NativeMethodName);
 		for (TFieldIterator<FProperty> It(Function, EFieldIteratorFlags::ExcludeSuper); It; ++It)
 		{
 			FProperty* Property = *It;
@@ -982,11 +1175,11 @@ void FCSGenerator::ExportClassFunctionStaticConstruction(FCSScriptBuilder& Build
 		Builder.BeginWithEditorOnlyBlock();
 	}
 	
-	Builder.AppendLine(FString::Printf(TEXT("%s_NativeFunction = %s.CallGetNativeFunctionFromClassAndName(NativeClassPtr, \"%s\");"), *NativeMethodName, UClassCallbacks, *Function->GetName()));
+	Builder.AppendLinef(TEXT("%s_NativeFunction = NativeLayout.GetFunction(\"%s\");"), *NativeMethodName, *NativeMethodName);
 	
 	if (Function->NumParms > 0)
 	{
-		Builder.AppendLine(FString::Printf(TEXT("%s_ParamsSize = %s.CallGetNativeFunctionParamsSize(%s_NativeFunction);"), *NativeMethodName, UFunctionCallbacks, *NativeMethodName));
+		Builder.AppendLinef(TEXT("%s_ParamsSize = NativeLayout.GetParamsSize(\"%s\");"), *NativeMethodName, *NativeMethodName);
 	}
 	
 	for (TFieldIterator<FProperty> It(Function, EFieldIteratorFlags::ExcludeSuper); It; ++It)
@@ -1005,10 +1198,16 @@ void FCSGenerator::ExportClassFunctionStaticConstruction(FCSScriptBuilder& Build
 void FCSGenerator::ExportDelegateFunctionStaticConstruction(FCSScriptBuilder& Builder, const UFunction* Function)
 {
 	FString NativeMethodName = Function->GetName();
-	Builder.AppendLine(FString::Printf(TEXT("%s_NativeFunction = FMulticastDelegatePropertyExporter.CallGetSignatureFunction(nativeDelegateProperty);"), *NativeMethodName));
+	Builder.AppendLine(TEXT("IntPtr signatureFunction = FMulticastDelegatePropertyExporter.CallGetSignatureFunction(nativeDelegateProperty);"));
+
+	TArray<FString> LayoutNames;
+	AddFunctionLayoutNames(LayoutNames, Function);
+	ExportTypeLayoutResolution(Builder, TEXT("signatureFunction"), LayoutNames);
+	
+	Builder.AppendLinef(TEXT("%s_NativeFunction = signatureFunction;"), *NativeMethodName);
 	if (Function->NumParms > 0)
 	{
-		Builder.AppendLine(FString::Printf(TEXT("%s_ParamsSize = %s.CallGetNativeFunctionParamsSize(%s_NativeFunction);"), *NativeMethodName, UFunctionCallbacks, *NativeMethodName));
+		Builder.AppendLinef(TEXT("%s_ParamsSize = NativeLayout.GetParamsSize(\"%s\");"), *NativeMethodName, *NativeMethodName);
 	}
 	
 	for (TFieldIterator<FProperty> It(Function, EFieldIteratorFlags::ExcludeSuper); It; ++It)
@@ -1019,6 +1218,34 @@ void FCSGenerator::ExportDelegateFunctionStaticConstruction(FCSScriptBuilder& Bu
 	}
 }
 
+void FCSGenerator::AddFunctionLayoutNames(TArray<FString>& OutNames, const UFunction* Function)
+{
+	const FString FunctionName = Function->GetName();
+	OutNames.Add(FunctionName + TEXT("()"));
+	
+	for (TFieldIterator<FProperty> It(Function, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		OutNames.Add(FString::Printf(TEXT("%s.%s"), *FunctionName, *It->GetName()));
+	}
+}
+
+void FCSGenerator::ExportTypeLayoutResolution(FCSScriptBuilder& Builder, const FString& NativeStructVariable, const TArray<FString>& Names)
+{
+	if (Names.IsEmpty())
+	{
+		return;
+	}
+	
+	FString PackedNames;
+	for (const FString& Name : Names)
+	{
+		PackedNames += Name;
+		PackedNames += TEXT("\\0");
+	}
+	
+	Builder.AppendLinef(TEXT("NativeTypeLayout NativeLayout = NativeTypeLayout.Resolve(%s, \"%s\");"), *NativeStructVariable, *PackedNames);
+}
+
 void FCSGenerator::ExportPropertiesStaticConstruction(FCSScriptBuilder& Builder, const TSet<FProperty*>& ExportedProperties, const TSet<FString>& ReservedNames)
 {
 	//we already warn on conflicts when exporting the properties themselves, so here we can just silently skip them
@@ -1143,16 +1370,16 @@ void FCSGenerator::ExportStructMarshaller(FCSScriptBuilder& Builder, const UScri
 	FString StructName = NameMapper.GetStructScriptName(Struct);
 
 	Builder.AppendLine();
-	Builder.AppendLine(FString::Printf(TEXT("public static class %sMarshaller"), *StructName));
+	Builder.AppendLinef(TEXT("public static class %sMarshaller"), *StructName);
 	Builder.OpenBrace();
 
-	Builder.AppendLine(FString::Printf(TEXT("public static %s FromNative(IntPtr nativeBuffer, int arrayIndex)"), *StructName));
+	Builder.AppendLinef(TEXT("public static %s FromNative(IntPtr nativeBuffer, int arrayIndex)"), *StructName);
 	Builder.OpenBrace();
-	Builder.AppendLine(FString::Printf(TEXT("return new %s(nativeBuffer + arrayIndex * GetNativeDataSize());"), *StructName));
+	Builder.AppendLinef(TEXT("return new %s(nativeBuffer + arrayIndex * GetNativeDataSize());"), *StructName);
 	Builder.CloseBrace(); // MarshalNativeToManaged
 
 	Builder.AppendLine();
-	Builder.AppendLine(FString::Printf(TEXT("public static void ToNative(IntPtr nativeBuffer, int arrayIndex, %s obj)"), *StructName));
+	Builder.AppendLinef(TEXT("public static void ToNative(IntPtr nativeBuffer, int arrayIndex, %s obj)"), *StructName);
 	Builder.OpenBrace();
 	Builder.AppendLine("obj.ToNative(nativeBuffer + arrayIndex * GetNativeDataSize());");
 	Builder.CloseBrace(); // MarshalManagedToNative
@@ -1160,7 +1387,7 @@ void FCSGenerator::ExportStructMarshaller(FCSScriptBuilder& Builder, const UScri
 	Builder.AppendLine();
 	Builder.AppendLine("public static int GetNativeDataSize()");
 	Builder.OpenBrace();
-	Builder.AppendLine(FString::Printf(TEXT("return %s.NativeDataSize;"), *StructName));
+	Builder.AppendLinef(TEXT("return %s.NativeDataSize;"), *StructName);
 	Builder.CloseBrace();
 	Builder.CloseBrace();
 }
@@ -1169,7 +1396,7 @@ void FCSGenerator::ExportMirrorStructMarshalling(FCSScriptBuilder& Builder, cons
 {
 	Builder.AppendLine();
 	Builder.AppendLine("// Construct by marshalling from a native buffer.");
-	Builder.AppendLine(FString::Printf(TEXT("public %s(IntPtr InNativeStruct)"), *NameMapper.GetStructScriptName(Struct)));
+	Builder.AppendLinef(TEXT("public %s(IntPtr InNativeStruct)"), *NameMapper.GetStructScriptName(Struct));
 	Builder.OpenBrace();
 	Builder.BeginUnsafeBlock();
 
@@ -1231,10 +1458,25 @@ FString FCSGenerator::GetSuperClassName(const UClass* Class) const
 void FCSGenerator::SaveTypeGlue(const UPackage* Package, const FString& TypeName, const FCSScriptBuilder& ScriptBuilder)
 {
 	const FString FileName = FString::Printf(TEXT("%s.generated.cs"), *TypeName);
-	SaveGlue(FindOrRegisterModule(Package), FileName, ScriptBuilder.ToString());
+	SaveGlue(FindOrRegisterModule(Package), FileName, ScriptBuilder);
 }
 
-void FCSGenerator::SaveGlue(const FCSModule& Bindings, const FString& Filename, const FString& GeneratedGlue)
+void FCSGenerator::SaveGlue(const FCSModule& Bindings, const FString& Filename, const FCSScriptBuilder& ScriptBuilder)
+{
+	TArray<uint8> GeneratedGlue;
+	ScriptBuilder.ToUTF8(GeneratedGlue);
+	
+	if (bDeferSaving)
+	{
+		FScopeLock Lock(&ExportLock);
+		PendingGlue.Add({ &Bindings, Filename, MoveTemp(GeneratedGlue) });
+		return;
+	}
+
+	WriteGlue(Bindings, Filename, GeneratedGlue);
+}
+
+void FCSGenerator::WriteGlue(const FCSModule& Bindings, const FString& Filename, TConstArrayView<uint8> GeneratedGlue)
 {
 	const FString& BindingsSourceDirectory = Bindings.GetGeneratedSourceDirectory();
 
@@ -1337,5 +1579,38 @@ void FCSGenerator::GatherModuleDependencies(const UClass* Class, TSet<const FCSM
 
 void FCSGenerator::AddExportedType(UObject* Object)
 {
+	FScopeLock Lock(&ExportLock);
 	ExportedTypes.Add(Object);
 }
+
+bool FCSGenerator::TryAddExportedType(UObject* Object)
+{
+	FScopeLock Lock(&ExportLock);
+	bool bAlreadyExported = false;
+	ExportedTypes.Add(Object, &bAlreadyExported);
+	return !bAlreadyExported;
+}
+
+bool FCSGenerator::TryAddExportedDelegate(UFunction* DelegateSignature)
+{
+	FScopeLock Lock(&ExportLock);
+	bool bAlreadyExported = false;
+	ExportedDelegates.Add(DelegateSignature, &bAlreadyExported);
+	return !bAlreadyExported;
+}
+
+bool FCSGenerator::IsTypeExported(UObject* Object)
+{
+	FScopeLock Lock(&ExportLock);
+	return ExportedTypes.Contains(Object);
+}
+
+void FCSGenerator::CommitPendingGlue()
+{
+	TArray<FCSPendingGlue> GlueToSave = MoveTemp(PendingGlue);
+	
+	for (const FCSPendingGlue& Glue : GlueToSave)
+	{
+		WriteGlue(*Glue.Module, Glue.FileName, Glue.GeneratedGlue);
+	}
+}
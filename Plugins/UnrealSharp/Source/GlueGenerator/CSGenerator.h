@@ -4,6 +4,7 @@
 #include "CSNameMapper.h"
 #include "CSModule.h"
 #include "CSGlueGeneratorFileManager.h"
+#include "CSGlueManifest.h"
 #include "CSInclusionLists.h"
 #include "CSPropertyTranslatorManager.h"
 #include "UObject/Stack.h"
@@ -34,7 +35,14 @@ public:
 	
 	void StartGenerator(const FString& OutputDirectory);
 
-	void GenerateGlueForPackage(const UPackage* Package);
+	// Forgets which types were exported and runs the full generation of StartGenerator again. Returns how long it took, in seconds.
+	// Without the manifest every type is built and compared against its file, like on a first run.
+	double RegenerateAllGlue(bool bUseManifest);
+
+	void GenerateGlueForPackage(UPackage* Package);
+	
+	// Exports all types in the packages on worker threads, then writes the generated files on the calling thread.
+	void GenerateGlueForPackages(const TArray<UPackage*>& Packages);
 	void GenerateGlueForTypes(TArray<UObject*>& ObjectsToProcess);
 	void GenerateGlueForType(UObject* Object, bool bForceExport = false);
 	void GenerateGlueForDelegate(UFunction* DelegateSignature, bool bForceExport = false);
@@ -72,7 +80,7 @@ public:
 	
 	FString GetSuperClassName(const UClass* Class) const;
 	void SaveTypeGlue(const UPackage* Package, const FString& TypeName, const FCSScriptBuilder& ScriptBuilder);
-	void SaveGlue(const FCSModule& Bindings, const FString& Filename, const FString& GeneratedGlue);
+	void SaveGlue(const FCSModule& Bindings, const FString& Filename, const FCSScriptBuilder& ScriptBuilder);
 	
 	void ExportClassProperties(FCSScriptBuilder& Builder, const UClass* Class, TSet<FProperty*>& ExportedProperties, const TSet<FString>& ReservedNames);
 	void ExportStaticConstructor(FCSScriptBuilder& Builder,  const UStruct* Struct,const TSet<FProperty*>& ExportedProperties,  const TSet<UFunction*>& ExportedFunctions, const TSet<UFunction*>& ExportedOverrideableFunctions, const TSet<FString>& ReservedNames);
@@ -83,6 +91,8 @@ public:
 	void ExportClassOverridableFunctionsStaticConstruction(FCSScriptBuilder& Builder, const TSet<UFunction*>& ExportedOverrideableFunctions) const;
 	void ExportClassFunctionStaticConstruction(FCSScriptBuilder& Builder, const UFunction *Function);
 	void ExportDelegateFunctionStaticConstruction(FCSScriptBuilder& Builder, const UFunction *Function);
+	static void AddFunctionLayoutNames(TArray<FString>& OutNames, const UFunction* Function);
+	static void ExportTypeLayoutResolution(FCSScriptBuilder& Builder, const FString& NativeStructVariable, const TArray<FString>& Names);
 	void ExportClassOverridableFunctions(FCSScriptBuilder& Builder, const TSet<UFunction*>& ExportedOverridableFunctions);
 	
 	static bool GetExtensionMethodInfo(ExtensionMethod& Info, UFunction* Function);
@@ -107,6 +117,11 @@ public:
 		return NameMapper;
 	}
 
+	FCSPropertyTranslatorManager& GetPropertyTranslatorManager()
+	{
+		return *PropertyTranslatorManager;
+	}
+
 protected:
 
 	FString GeneratedScriptsDirectory;
@@ -116,6 +131,7 @@ protected:
 	TUniquePtr<FCSPropertyTranslatorManager> PropertyTranslatorManager;
 	FCSNameMapper NameMapper;
 	FCSGlueGeneratorFileManager GeneratedFileManager;
+	FCSGlueManifest GlueManifest;
 	
 	FCSInclusionLists AllowList;
 	FCSInclusionLists DenyList;
@@ -123,11 +139,45 @@ protected:
 	FCSInclusionLists OverrideInternalList;
 
 	TMap<FName, TArray<ExtensionMethod>> ExtensionMethods;
-	TMap<FName, FCSModule> CSharpBindingsModules;
+	// Modules are handed out by reference while other threads may register new ones,
+	// so each one is allocated on its own and doesn't move when the map grows.
+	TMap<FName, TUniquePtr<FCSModule>> CSharpBindingsModules;
 	TSet<UObject*> ExportedTypes;
 
 private:
 
+	struct FCSPendingGlue
+	{
+		const FCSModule* Module;
+		FString FileName;
+		TArray<uint8> GeneratedGlue;
+	};
+
 	void CheckGlueGeneratorVersion() const;
+
+	// Exports every loaded package and the types that don't get picked up otherwise, then prunes and saves the manifest.
+	double GenerateGlueForLoadedPackages();
+
+	// Keeps the glue from the previous run if the type's hash still matches the manifest. Claims the type
+	// and exports the types it referenced back then if so.
+	bool TryKeepExistingGlue(UObject* Type, uint32& OutTypeHash);
+	FString GetTypeGluePath(const UObject* Type);
+
+	// Returns false if the type was already claimed by another export.
+	bool TryAddExportedType(UObject* Object);
+	bool TryAddExportedDelegate(UFunction* DelegateSignature);
+	bool IsTypeExported(UObject* Object);
+
+	void CommitPendingGlue();
+	void WriteGlue(const FCSModule& Bindings, const FString& Filename, TConstArrayView<uint8> GeneratedGlue);
+	
 	TSet<UFunction*> ExportedDelegates;
+
+	// Guards ExportedTypes, ExportedDelegates, ExtensionMethods and PendingGlue while types are exported in parallel.
+	FCriticalSection ExportLock;
+	FRWLock ModulesLock;
+
+	// Files are only written once all worker threads are done, so they are queued here in the meantime.
+	bool bDeferSaving = false;
+	TArray<FCSPendingGlue> PendingGlue;
 };
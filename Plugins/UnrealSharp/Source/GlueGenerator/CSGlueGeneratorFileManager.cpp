@@ -2,15 +2,20 @@
 #include "GlueGeneratorModule.h"
 #include "Misc/FileHelper.h"
 
-void FCSGlueGeneratorFileManager::SaveFileIfChanged(const FString& FilePath, const FString& NewFileContents)
+void FCSGlueGeneratorFileManager::SaveFileIfChanged(const FString& FilePath, TConstArrayView<uint8> NewFileContents)
 {
-	FString OriginalFileContents;
-	bool bFileExists = FFileHelper::LoadFileToString(OriginalFileContents, *FilePath);
-
-	if (!bFileExists || OriginalFileContents != NewFileContents)
+	// Files of a different size can't be identical, so only those of the same size have to be read back.
+	if (IFileManager::Get().FileSize(*FilePath) == NewFileContents.Num())
 	{
-		FFileHelper::SaveStringToFile(NewFileContents, *FilePath);
+		TArray<uint8> OriginalFileContents;
+		if (FFileHelper::LoadFileToArray(OriginalFileContents, *FilePath, FILEREAD_Silent)
+			&& FMemory::Memcmp(OriginalFileContents.GetData(), NewFileContents.GetData(), NewFileContents.Num()) == 0)
+		{
+			return;
+		}
 	}
+	
+	FFileHelper::SaveArrayToFile(NewFileContents, *FilePath);
 }
 
 void FCSGlueGeneratorFileManager::RenameTempFiles()
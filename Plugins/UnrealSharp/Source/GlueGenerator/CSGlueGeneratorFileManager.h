@@ -4,8 +4,8 @@ class FCSGlueGeneratorFileManager
 {
 public:
 	
-	/** Saves generated script glue to a temporary file if its contents is different from the existing one. */
-	static void SaveFileIfChanged(const FString& FilePath, const FString& NewFileContents);
+	/** Saves generated UTF-8 script glue if its contents is different from the existing file. */
+	static void SaveFileIfChanged(const FString& FilePath, TConstArrayView<uint8> NewFileContents);
 	
 	/** Renames/replaces all existing script glue files with the temporary (new) ones */
 	void RenameTempFiles();
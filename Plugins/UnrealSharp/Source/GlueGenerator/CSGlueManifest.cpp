@@ -0,0 +1,316 @@
+﻿#include "CSGlueManifest.h"
+#include "GlueGeneratorModule.h"
+#include "Misc/PackageName.h"
+#include "Misc/ScopeLock.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/MetaData.h"
+#include "UObject/UnrealType.h"
+
+void FCSGlueManifest::Load(const FString& InManifestPath)
+{
+	ManifestPath = InManifestPath;
+	Entries.Reset();
+	
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*ManifestPath));
+	if (!Reader)
+	{
+		return;
+	}
+
+	int32 Version = 0;
+	*Reader << Version;
+
+	if (Version != GLUE_GENERATOR_VERSION)
+	{
+		return;
+	}
+
+	*Reader << Entries;
+
+	if (Reader->IsError())
+	{
+		UE_LOG(LogGlueGenerator, Warning, TEXT("Glue manifest %s is corrupt, regenerating all glue."), *ManifestPath);
+		Entries.Reset();
+	}
+}
+
+void FCSGlueManifest::Save()
+{
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*ManifestPath));
+	if (!Writer)
+	{
+		UE_LOG(LogGlueGenerator, Error, TEXT("Could not write glue manifest %s"), *ManifestPath);
+		return;
+	}
+
+	FScopeLock Lock(&EntriesLock);
+	int32 Version = GLUE_GENERATOR_VERSION;
+	*Writer << Version;
+	*Writer << Entries;
+}
+
+void FCSGlueManifest::Reset()
+{
+	FScopeLock Lock(&EntriesLock);
+	Entries.Reset();
+}
+
+bool FCSGlueManifest::IsUpToDate(const UObject* Type, uint32 TypeHash)
+{
+	FScopeLock Lock(&EntriesLock);
+	FEntry* Entry = Entries.Find(Type->GetPathName());
+	
+	if (!Entry || Entry->Hash != TypeHash)
+	{
+		return false;
+	}
+
+	Entry->bUsed = true;
+	return true;
+}
+
+TArray<FString> FCSGlueManifest::GetReferences(const UObject* Type) const
+{
+	FScopeLock Lock(&EntriesLock);
+	const FEntry* Entry = Entries.Find(Type->GetPathName());
+	return Entry ? Entry->References : TArray<FString>();
+}
+
+void FCSGlueManifest::Update(const UObject* Type, uint32 TypeHash, const FString& GluePath, TArray<FString> References)
+{
+	FScopeLock Lock(&EntriesLock);
+	FEntry& Entry = Entries.FindOrAdd(Type->GetPathName());
+	Entry.Hash = TypeHash;
+	Entry.GluePath = GluePath;
+	Entry.References = MoveTemp(References);
+	Entry.bUsed = true;
+}
+
+void FCSGlueManifest::PruneUnusedEntries()
+{
+	check(IsInGameThread());
+	FScopeLock Lock(&EntriesLock);
+
+	// Types of modules that load later in the session haven't been through the generator yet, so only the entries
+	// that can't be exported anymore go: their package is loaded but they weren't exported, or their module is gone.
+	TArray<FString> KeptTypes;
+	for (const TPair<FString, FEntry>& Pair : Entries)
+	{
+		if (Pair.Value.bUsed || !CanBePruned(Pair.Key))
+		{
+			KeptTypes.Add(Pair.Key);
+		}
+	}
+
+	// Kept glue still refers to the types it exported back then, even if nothing loaded so far does.
+	TSet<FString> KeptTypeSet;
+	while (!KeptTypes.IsEmpty())
+	{
+		FString TypePath = KeptTypes.Pop(EAllowShrinking::No);
+		bool bAlreadyKept = false;
+		KeptTypeSet.Add(TypePath, &bAlreadyKept);
+
+		if (!bAlreadyKept)
+		{
+			if (const FEntry* Entry = Entries.Find(TypePath))
+			{
+				KeptTypes.Append(Entry->References);
+			}
+		}
+	}
+
+	TSet<FString> UsedGluePaths;
+	for (const TPair<FString, FEntry>& Pair : Entries)
+	{
+		if (KeptTypeSet.Contains(Pair.Key))
+		{
+			UsedGluePaths.Add(Pair.Value.GluePath);
+		}
+	}
+
+	int32 NumPruned = 0;
+	for (TMap<FString, FEntry>::TIterator It = Entries.CreateIterator(); It; ++It)
+	{
+		if (KeptTypeSet.Contains(It->Key))
+		{
+			continue;
+		}
+
+		// Keep the file if a type that is still exported writes to the same path.
+		if (!UsedGluePaths.Contains(It->Value.GluePath))
+		{
+			IFileManager::Get().Delete(*It->Value.GluePath, false, false, true);
+		}
+		
+		It.RemoveCurrent();
+		++NumPruned;
+	}
+
+	if (NumPruned > 0)
+	{
+		UE_LOG(LogGlueGenerator, Log, TEXT("Removed the glue of %d types that are no longer exported."), NumPruned);
+	}
+}
+
+bool FCSGlueManifest::CanBePruned(const FString& TypePath)
+{
+	const FString PackageName = FPackageName::ObjectPathToPackageName(TypePath);
+	if (FindPackage(nullptr, *PackageName))
+	{
+		return true;
+	}
+
+	FString ModuleName;
+	if (PackageName.Split(TEXT("/Script/"), nullptr, &ModuleName, ESearchCase::CaseSensitive) && !ModuleName.Contains(TEXT("/")))
+	{
+		return !FModuleManager::Get().ModuleExists(*ModuleName);
+	}
+
+	return !FPackageName::DoesPackageExist(PackageName);
+}
+
+uint32 FCSGlueManifest::HashType(const UObject* Type)
+{
+	uint32 Hash = GLUE_GENERATOR_VERSION;
+	HashString(Type->GetPathName(), Hash);
+	HashMetaData(UMetaData::GetMapForObject(Type), Hash);
+
+	if (const UEnum* Enum = Cast<UEnum>(Type))
+	{
+		for (int32 i = 0; i < Enum->NumEnums(); ++i)
+		{
+			const int64 Value = Enum->GetValueByIndex(i);
+			HashString(Enum->GetNameStringByIndex(i), Hash);
+			Hash = FCrc::MemCrc32(&Value, sizeof(Value), Hash);
+		}
+	}
+	else if (const UStruct* Struct = Cast<UStruct>(Type))
+	{
+		TSet<const UStruct*> Visited;
+		HashStruct(Struct, Hash, Visited);
+	}
+
+	return Hash;
+}
+
+void FCSGlueManifest::HashStruct(const UStruct* Struct, uint32& Hash, TSet<const UStruct*>& Visited)
+{
+	bool bAlreadyVisited = false;
+	Visited.Add(Struct, &bAlreadyVisited);
+	
+	if (bAlreadyVisited)
+	{
+		HashString(Struct->GetPathName(), Hash);
+		return;
+	}
+	
+	if (const UStruct* SuperStruct = Struct->GetSuperStruct())
+	{
+		// Structs export their parent's properties as their own.
+		if (Struct->IsA<UScriptStruct>())
+		{
+			HashStruct(SuperStruct, Hash, Visited);
+		}
+		else
+		{
+			HashString(SuperStruct->GetPathName(), Hash);
+		}
+	}
+
+	const int32 StructureSize = Struct->GetStructureSize();
+	Hash = FCrc::MemCrc32(&StructureSize, sizeof(StructureSize), Hash);
+
+	if (const UClass* Class = Cast<UClass>(Struct))
+	{
+		const EClassFlags ClassFlags = Class->GetClassFlags();
+		Hash = FCrc::MemCrc32(&ClassFlags, sizeof(ClassFlags), Hash);
+		
+		// Classes export the functions of the interfaces they implement.
+		for (const FImplementedInterface& Interface : Class->Interfaces)
+		{
+			HashStruct(Interface.Class, Hash, Visited);
+		}
+	}
+	else if (const UFunction* Function = Cast<UFunction>(Struct))
+	{
+		const EFunctionFlags FunctionFlags = Function->FunctionFlags;
+		Hash = FCrc::MemCrc32(&FunctionFlags, sizeof(FunctionFlags), Hash);
+	}
+	
+	for (TFieldIterator<FProperty> It(Struct, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		HashProperty(*It, Hash, Visited);
+	}
+
+	for (TFieldIterator<UFunction> It(Struct, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		HashString(It->GetName(), Hash);
+		HashMetaData(UMetaData::GetMapForObject(*It), Hash);
+		HashStruct(*It, Hash, Visited);
+	}
+}
+
+void FCSGlueManifest::HashProperty(const FProperty* Property, uint32& Hash, TSet<const UStruct*>& Visited)
+{
+	HashString(Property->GetName(), Hash);
+	
+	// The C++ type covers the classes, structs and enums the property refers to, and its inner properties.
+	HashString(Property->GetCPPType(), Hash);
+
+	const EPropertyFlags PropertyFlags = Property->PropertyFlags;
+	const int32 Layout[] = { Property->ArrayDim, Property->ElementSize, Property->GetOffset_ForInternal() };
+	Hash = FCrc::MemCrc32(&PropertyFlags, sizeof(PropertyFlags), Hash);
+	Hash = FCrc::MemCrc32(Layout, sizeof(Layout), Hash);
+
+#if WITH_METADATA
+	HashMetaData(Property->GetMetaDataMap(), Hash);
+#endif
+
+	// Whether a struct is blittable, and so how it's marshalled, depends on its own properties.
+	if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+	{
+		HashStruct(StructProperty->Struct, Hash, Visited);
+	}
+	else if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+	{
+		HashProperty(ArrayProperty->Inner, Hash, Visited);
+	}
+	else if (const FSetProperty* SetProperty = CastField<FSetProperty>(Property))
+	{
+		HashProperty(SetProperty->ElementProp, Hash, Visited);
+	}
+	else if (const FMapProperty* MapProperty = CastField<FMapProperty>(Property))
+	{
+		HashProperty(MapProperty->KeyProp, Hash, Visited);
+		HashProperty(MapProperty->ValueProp, Hash, Visited);
+	}
+	else if (const FDelegateProperty* DelegateProperty = CastField<FDelegateProperty>(Property))
+	{
+		HashStruct(DelegateProperty->SignatureFunction, Hash, Visited);
+	}
+	else if (const FMulticastDelegateProperty* MulticastDelegateProperty = CastField<FMulticastDelegateProperty>(Property))
+	{
+		HashStruct(MulticastDelegateProperty->SignatureFunction, Hash, Visited);
+	}
+}
+
+void FCSGlueManifest::HashMetaData(const TMap<FName, FString>* MetaData, uint32& Hash)
+{
+	if (!MetaData)
+	{
+		return;
+	}
+	
+	for (const TPair<FName, FString>& Pair : *MetaData)
+	{
+		HashString(Pair.Key.ToString(), Hash);
+		HashString(Pair.Value, Hash);
+	}
+}
+
+void FCSGlueManifest::HashString(const FString& String, uint32& Hash)
+{
+	const int32 Length = String.Len();
+	Hash = FCrc::MemCrc32(&Length, sizeof(Length), Hash);
+	Hash = FCrc::MemCrc32(*String, Length * sizeof(TCHAR), Hash);
+}
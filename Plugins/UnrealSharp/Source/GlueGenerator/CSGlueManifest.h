@@ -0,0 +1,64 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Remembers a hash of every type's reflected shape from the previous run, so glue for unchanged types
+// can be kept without building it or reading the existing file.
+// Entries of types that are gone are pruned after a full run, along with their glue.
+class FCSGlueManifest
+{
+public:
+
+	void Load(const FString& InManifestPath);
+	void Save();
+
+	// Forgets every entry, so all types are built again.
+	void Reset();
+
+	// Whether the type had the same hash when its glue was last written. Keeps the entry if so.
+	bool IsUpToDate(const UObject* Type, uint32 TypeHash);
+
+	// Path names of the types that were exported because this type referenced them, when its glue was last written.
+	TArray<FString> GetReferences(const UObject* Type) const;
+	
+	void Update(const UObject* Type, uint32 TypeHash, const FString& GluePath, TArray<FString> References);
+
+	// Forgets the types that weren't kept or updated since the manifest was loaded and can't come back later in the session,
+	// and deletes their glue. Types that kept glue refers to are never pruned.
+	void PruneUnusedEntries();
+
+	// Hashes everything about the type that ends up in its glue, including the shape of structs it holds by value
+	// and the signatures of its delegates. Seeded with the generator version, so new generators regenerate everything.
+	static uint32 HashType(const UObject* Type);
+
+private:
+
+	struct FEntry
+	{
+		uint32 Hash = 0;
+		FString GluePath;
+		TArray<FString> References;
+
+		// Not saved, only tells which entries the current run still uses.
+		bool bUsed = false;
+
+		friend FArchive& operator<<(FArchive& Ar, FEntry& Entry)
+		{
+			return Ar << Entry.Hash << Entry.GluePath << Entry.References;
+		}
+	};
+
+	// Whether the type's package is loaded, so it would have been exported if it still was, or can't be loaded anymore.
+	static bool CanBePruned(const FString& TypePath);
+
+	// Visited guards against structs that reach themselves through delegate parameters.
+	static void HashStruct(const UStruct* Struct, uint32& Hash, TSet<const UStruct*>& Visited);
+	static void HashProperty(const FProperty* Property, uint32& Hash, TSet<const UStruct*>& Visited);
+	static void HashMetaData(const TMap<FName, FString>* MetaData, uint32& Hash);
+	static void HashString(const FString& String, uint32& Hash);
+
+	FString ManifestPath;
+	TMap<FString, FEntry> Entries;
+	mutable FCriticalSection EntriesLock;
+	
+};
@@ -30,6 +30,7 @@
 #include "PropertyTranslators/StructPropertyTranslator.h"
 #include "PropertyTranslators/TextPropertyTranslator.h"
 #include "PropertyTranslators/WeakObjectPropertyTranslator.h"
+#include "Misc/ScopeRWLock.h"
 
 using namespace ScriptGeneratorUtilities;
 
@@ -100,6 +101,29 @@ FCSPropertyTranslatorManager::FCSPropertyTranslatorManager(const FCSNameMapper&
 }
 
 const FPropertyTranslator& FCSPropertyTranslatorManager::Find(const FProperty* Property) const
+{
+	if (!bCachesEnabled)
+	{
+		return FindUncached(Property);
+	}
+	
+	{
+		FReadScopeLock ReadLock(CacheLock);
+		if (const FPropertyTranslator* const* CachedTranslator = TranslatorCache.Find(Property))
+		{
+			return **CachedTranslator;
+		}
+	}
+
+	// Not holding the lock, CanHandleProperty may call back into Find for inner properties.
+	const FPropertyTranslator& Translator = FindUncached(Property);
+
+	FWriteScopeLock WriteLock(CacheLock);
+	TranslatorCache.Add(Property, &Translator);
+	return Translator;
+}
+
+const FPropertyTranslator& FCSPropertyTranslatorManager::FindUncached(const FProperty* Property) const
 {
 	const TArray<FPropertyTranslator*>* Translators = TranslatorMap.Find(Property->GetClass()->GetFName());
 	
@@ -130,9 +154,33 @@ const FPropertyTranslator& FCSPropertyTranslatorManager::Find(UFunction* Functio
 	return *NullHandler;
 }
 
+void FCSPropertyTranslatorManager::ResetCaches()
+{
+	FWriteScopeLock WriteLock(CacheLock);
+	TranslatorCache.Reset();
+	BlittableStructCache.Reset();
+}
+
 bool FCSPropertyTranslatorManager::IsStructBlittable(const UScriptStruct& ScriptStruct) const
 {
-	return FBlittableStructPropertyTranslator::IsStructBlittable(*this, ScriptStruct);
+	if (!bCachesEnabled)
+	{
+		return FBlittableStructPropertyTranslator::IsStructBlittable(*this, ScriptStruct);
+	}
+	
+	{
+		FReadScopeLock ReadLock(CacheLock);
+		if (const bool* bCachedIsBlittable = BlittableStructCache.Find(&ScriptStruct))
+		{
+			return *bCachedIsBlittable;
+		}
+	}
+	
+	const bool bIsBlittable = FBlittableStructPropertyTranslator::IsStructBlittable(*this, ScriptStruct);
+
+	FWriteScopeLock WriteLock(CacheLock);
+	BlittableStructCache.Add(&ScriptStruct, bIsBlittable);
+	return bIsBlittable;
 }
 
 void FCSPropertyTranslatorManager::AddPropertyTranslator(FFieldClass* PropertyClass, FPropertyTranslator* Handler)
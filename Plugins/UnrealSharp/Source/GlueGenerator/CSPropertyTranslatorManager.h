@@ -34,6 +34,13 @@ public:
 
 	bool IsStructBlittable(const UScriptStruct& ScriptStruct) const;
 
+	// The caches are keyed by address, and properties and structs can be freed and reallocated
+	// between generations, e.g. on hot reload. So they only live for one generation.
+	void ResetCaches();
+
+	// Turns the caches off to measure what they save. Only change this between generations.
+	void SetCachesEnabled(bool bEnabled) { bCachesEnabled = bEnabled; }
+
 	const FCSNameMapper& GetScriptNameMapper() const { return NameMapper; }
 	
 private:
@@ -42,6 +49,15 @@ private:
 	TUniquePtr<FNullPropertyTranslator> NullHandler;
 	TMap<FName, TArray<FPropertyTranslator*>> TranslatorMap;
 
+	// Find and IsStructBlittable are asked about the same properties and structs many times per type,
+	// and the blittable check recurses through struct members. Results are cached, guarded for parallel glue generation.
+	mutable FRWLock CacheLock;
+	bool bCachesEnabled = true;
+	mutable TMap<const FProperty*, const FPropertyTranslator*> TranslatorCache;
+	mutable TMap<const UScriptStruct*, bool> BlittableStructCache;
+
+	const FPropertyTranslator& FindUncached(const FProperty* Property) const;
+
 	void AddPropertyTranslator(FFieldClass* PropertyClass, FPropertyTranslator* Handler);
 	void AddBlittablePropertyTranslator(FFieldClass* PropertyClass, const FString& CSharpType);
 	void AddBlittableCustomStructPropertyTranslator(const FString& UnrealName, const FString& CSharpName, FCSInclusionLists& Blacklist);
@@ -18,6 +18,54 @@ const FName MD_DefaultToSelf(TEXT("DefaultToSelf"));
 const FName MD_Latent(TEXT("Latent"));
 const FName NAME_ToolTip(TEXT("ToolTip"));
 
+namespace
+{
+	thread_local TArray<TUniquePtr<TStringBuilder<2048>>> PooledBuffers;
+
+	// Builders only nest as deep as the chain of referenced types, so a handful per thread covers it.
+	constexpr int32 MaxPooledBuffers = 8;
+
+	// A few huge types shouldn't keep megabytes alive on every worker thread for the rest of the session.
+	constexpr int32 MaxPooledBufferLength = 256 * 1024;
+}
+
+TUniquePtr<FCSScriptBuilder::FBuffer> FCSScriptBuilder::AcquireBuffer()
+{
+	if (PooledBuffers.IsEmpty())
+	{
+		return MakeUnique<FBuffer>();
+	}
+
+	return PooledBuffers.Pop(EAllowShrinking::No);
+}
+
+void FCSScriptBuilder::ReleaseBuffer(TUniquePtr<FBuffer> InBuffer)
+{
+	if (PooledBuffers.Num() >= MaxPooledBuffers || InBuffer->Len() > MaxPooledBufferLength)
+	{
+		return;
+	}
+	
+	InBuffer->Reset();
+	PooledBuffers.Push(MoveTemp(InBuffer));
+}
+
+void FCSScriptBuilder::AppendIndent()
+{
+	static const FString Spaces = FString::ChrN(64, TEXT(' '));
+	static const FString Tabs = FString::ChrN(16, TEXT('\t'));
+
+	const FString& IndentString = IndentMode == IndentType::Spaces ? Spaces : Tabs;
+	int32 RemainingChars = IndentMode == IndentType::Spaces ? IndentCount * 4 : IndentCount;
+
+	while (RemainingChars > 0)
+	{
+		const int32 NumChars = FMath::Min(RemainingChars, IndentString.Len());
+		Report.Append(*IndentString, NumChars);
+		RemainingChars -= NumChars;
+	}
+}
+
 void FCSScriptBuilder::GenerateScriptSkeleton(const FString& Namespace)
 {
 	DeclareDirective(UNREAL_SHARP_ENGINE_NAMESPACE);
@@ -27,7 +75,7 @@ void FCSScriptBuilder::GenerateScriptSkeleton(const FString& Namespace)
 	DeclareDirective(TEXT("System.Runtime.InteropServices"));
 	
 	AppendLine();
-	AppendLine(FString::Printf(TEXT("namespace %s;"), *Namespace));
+	AppendLinef(TEXT("namespace %s;"), *Namespace);
 
 	AppendLine();
 }
@@ -41,7 +89,7 @@ void FCSScriptBuilder::DeclareDirective(const FString& ModuleName)
 
 	Directives.Add(ModuleName);
 
-	AppendLine(FString::Printf(TEXT("using %s;"), *ModuleName));
+	AppendLinef(TEXT("using %s;"), *ModuleName);
 }
 
 void FCSScriptBuilder::DeclareType(
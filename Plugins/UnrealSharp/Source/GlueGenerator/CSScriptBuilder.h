@@ -27,12 +27,21 @@ public:
 		Tabs
 	};
 	explicit FCSScriptBuilder(IndentType InIndentMode)
-	: UnsafeBlockCount(0)
+	: Buffer(AcquireBuffer())
+	, Report(*Buffer)
+	, UnsafeBlockCount(0)
 	, IndentCount(0)
 	, IndentMode(InIndentMode)
 	{
 	}
 
+	~FCSScriptBuilder()
+	{
+		ReleaseBuffer(MoveTemp(Buffer));
+	}
+
+	UE_NONCOPYABLE(FCSScriptBuilder);
+
 	void Indent()
 	{
 		++IndentCount;
@@ -50,20 +59,15 @@ public:
 			Report.Append(LINE_TERMINATOR);
 		}
 
-		if (IndentMode == IndentType::Spaces)
-		{
-			for (int32 Index = 0; Index < IndentCount; Index++)
-			{
-				Report.Append(TEXT("    "));
-			}
-		}
-		else
-		{
-			for (int32 Index = 0; Index < IndentCount; Index++)
-			{
-				Report.Append(TEXT("\t"));
-			}
-		}
+		AppendIndent();
+	}
+
+	// Formats straight into the buffer, instead of through an FString::Printf temporary.
+	template <typename FmtType, typename... Types>
+	void AppendLinef(const FmtType& Fmt, Types... Args)
+	{
+		AppendLine();
+		Report.Appendf(Fmt, Args...);
 	}
 
 	void Append(FStringView String)
@@ -83,7 +87,7 @@ public:
 
 	void Append(const FName& Name)
 	{
-		Report.Append(Name.ToString());
+		Name.AppendString(Report);
 	}
 
 	void AppendLine(const FText& Text)
@@ -121,7 +125,7 @@ public:
 	void AppendLine(const FName& Name)
 	{
 		AppendLine();
-		Report.Append(Name.ToString());
+		Name.AppendString(Report);
 	}
 
 	void AppendLine(const TCHAR* Line)
@@ -159,7 +163,7 @@ public:
 
 	void BeginPreprocessorBlock(const FString& DirectiveCondition)
 	{
-		AppendLine(FString::Printf(TEXT("#if %s"), *DirectiveCondition));
+		AppendLinef(TEXT("#if %s"), *DirectiveCondition);
 	}
 
 	void EndPreprocessorBlock()
@@ -180,7 +184,7 @@ public:
 	{
 		if (!UnsafeBlockCount)
 		{
-			AppendLine(FString::Printf(TEXT("unsafe { %s }"), *Line));
+			AppendLinef(TEXT("unsafe { %s }"), *Line);
 		}
 		else
 		{
@@ -208,6 +212,13 @@ public:
 		return Report.ToString();
 	}
 
+	// Converts straight from the buffer, so saving doesn't need an FString copy of the whole file first.
+	void ToUTF8(TArray<uint8>& OutBytes) const
+	{
+		const FTCHARToUTF8 Converted(Report.GetData(), Report.Len());
+		OutBytes.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+	}
+
 	bool IsEmpty() const
 	{
 		return Report.Len() == 0;
@@ -224,7 +235,17 @@ public:
 
 private:
 
-	TStringBuilder<2048> Report;
+	using FBuffer = TStringBuilder<2048>;
+
+	// Builders are created for every exported type, and nest when a type exports the types it references.
+	// Each thread keeps a few of its buffers, so they only grow a few times per run instead of once per file.
+	static TUniquePtr<FBuffer> AcquireBuffer();
+	static void ReleaseBuffer(TUniquePtr<FBuffer> InBuffer);
+
+	void AppendIndent();
+
+	TUniquePtr<FBuffer> Buffer;
+	FBuffer& Report;
 	TArray<FString> Directives;
 	int32 UnsafeBlockCount;
 	int32 IndentCount;
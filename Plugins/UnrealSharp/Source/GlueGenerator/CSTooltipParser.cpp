@@ -149,7 +149,7 @@ void FCSTooltipParser::MakeCSharpTooltip(FCSScriptBuilder& Builder, const FText&
 		Builder.AppendLine(TEXT("/// <summary>"));
 		for (const FString& Line : Lines)
 		{
-			Builder.AppendLine(FString::Printf(TEXT("/// %s"), *Line));
+			Builder.AppendLinef(TEXT("/// %s"), *Line);
 		}
 		Builder.AppendLine(TEXT("/// </summary>"));
 	}
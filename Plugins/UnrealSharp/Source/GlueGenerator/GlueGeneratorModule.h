@@ -5,7 +5,7 @@
 
 class FCSGenerator;
 
-#define GLUE_GENERATOR_VERSION 5
+#define GLUE_GENERATOR_VERSION 7
 #define GLUE_GENERATOR_CONFIG TEXT("GlueGeneratorSettings")
 #define GLUE_GENERATOR_VERSION_KEY TEXT("GlueGeneratorVersion")
 
@@ -35,43 +35,43 @@ FString FArrayPropertyTranslator::GetManagedType(const FProperty* Property) cons
 void FArrayPropertyTranslator::ExportPropertyStaticConstruction(FCSScriptBuilder& Builder, const FProperty* Property, const FString& NativePropertyName) const
 {
 	FPropertyTranslator::ExportPropertyStaticConstruction(Builder, Property, NativePropertyName);
-	Builder.AppendLine(FString::Printf(TEXT("%s_NativeProperty = %s.CallGetNativePropertyFromName(NativeClassPtr, \"%s\");"), *NativePropertyName, FPropertyCallbacks,  *NativePropertyName));
+	MakeGetNativePropertyFromName(Builder, NativePropertyName);
 }
 
 void FArrayPropertyTranslator::ExportParameterStaticConstruction(FCSScriptBuilder& Builder, const FString& NativeMethodName, const FProperty* Parameter) const
 {
 	FPropertyTranslator::ExportParameterStaticConstruction(Builder, NativeMethodName, Parameter);
 	const FString ParamName = Parameter->GetName();
-	Builder.AppendLine(FString::Printf(TEXT("%s_%s_NativeProperty = %s.CallGetNativePropertyFromName(%s_NativeFunction, \"%s\");"), *NativeMethodName, *ParamName, FPropertyCallbacks, *NativeMethodName, *ParamName));
+	Builder.AppendLinef(TEXT("%s_%s_NativeProperty = NativeLayout.GetProperty(\"%s.%s\");"), *NativeMethodName, *ParamName, *NativeMethodName, *ParamName);
 }
 
 void FArrayPropertyTranslator::ExportPropertyVariables(FCSScriptBuilder& Builder, const FProperty* Property, const FString& NativePropertyName) const
 {
 	FPropertyTranslator::ExportPropertyVariables(Builder, Property, NativePropertyName);
-	Builder.AppendLine(FString::Printf(TEXT("static IntPtr %s_NativeProperty;"), *NativePropertyName));
+	Builder.AppendLinef(TEXT("static IntPtr %s_NativeProperty;"), *NativePropertyName);
 
 	bool IsStructProperty = Property->GetOwnerStruct()->IsA<UScriptStruct>();
 	if (IsStructProperty)
 	{
-		Builder.AppendLine(FString::Printf(TEXT("static %s %s_Marshaller = null;"), *GetWrapperType(Property), *NativePropertyName));
+		Builder.AppendLinef(TEXT("static %s %s_Marshaller = null;"), *GetWrapperType(Property), *NativePropertyName);
 	}
 	else
 	{
-		Builder.AppendLine(FString::Printf(TEXT("%s %s_Marshaller = null;"), *GetWrapperType(Property), *NativePropertyName));
+		Builder.AppendLinef(TEXT("%s %s_Marshaller = null;"), *GetWrapperType(Property), *NativePropertyName);
 	}
 }
 
 void FArrayPropertyTranslator::ExportParameterVariables(FCSScriptBuilder& Builder, UFunction* Function, const FString& NativeMethodName, FProperty* ParamProperty, const FString& NativePropertyName) const
 {
 	FPropertyTranslator::ExportParameterVariables(Builder, Function, NativeMethodName, ParamProperty, NativePropertyName);
-	Builder.AppendLine(FString::Printf(TEXT("static IntPtr %s_%s_NativeProperty;"), *NativeMethodName, *NativePropertyName));
+	Builder.AppendLinef(TEXT("static IntPtr %s_%s_NativeProperty;"), *NativeMethodName, *NativePropertyName);
 	if (Function->HasAnyFunctionFlags(FUNC_Static))
 	{
-		Builder.AppendLine(FString::Printf(TEXT("static %s %s_%s_Marshaller = null;"), *GetWrapperType(ParamProperty), *NativeMethodName, *NativePropertyName));
+		Builder.AppendLinef(TEXT("static %s %s_%s_Marshaller = null;"), *GetWrapperType(ParamProperty), *NativeMethodName, *NativePropertyName);
 	}
 	else
 	{
-		Builder.AppendLine(FString::Printf(TEXT("%s %s_%s_Marshaller = null;"), *GetWrapperType(ParamProperty), *NativeMethodName, *NativePropertyName));
+		Builder.AppendLinef(TEXT("%s %s_%s_Marshaller = null;"), *GetWrapperType(ParamProperty), *NativeMethodName, *NativePropertyName);
 	}
 }
 
@@ -81,10 +81,10 @@ void FArrayPropertyTranslator::ExportPropertyGetter(FCSScriptBuilder& Builder, c
 	const FProperty* InnerProperty = ArrayProperty.Inner;
 	const FPropertyTranslator& Handler = PropertyHandlers.Find(InnerProperty);
 
-	Builder.AppendLine(FString::Printf(TEXT("%s_Marshaller ??= new %s(1, %s_NativeProperty, %s);"), *NativePropertyName, *GetWrapperType(Property), *NativePropertyName, *Handler.ExportMarshallerDelegates(InnerProperty, NativePropertyName)));
+	Builder.AppendLinef(TEXT("%s_Marshaller ??= new %s(1, %s_NativeProperty, %s);"), *NativePropertyName, *GetWrapperType(Property), *NativePropertyName, *Handler.ExportMarshallerDelegates(InnerProperty, NativePropertyName));
 
 	Builder.AppendLine();
-	Builder.AppendLine(FString::Printf(TEXT("return %s_Marshaller.FromNative(IntPtr.Add(NativeObject,%s_Offset),0);"), *NativePropertyName, *NativePropertyName));
+	Builder.AppendLinef(TEXT("return %s_Marshaller.FromNative(IntPtr.Add(NativeObject,%s_Offset),0);"), *NativePropertyName, *NativePropertyName);
 }
 
 void FArrayPropertyTranslator::ExportMarshalToNativeBuffer(FCSScriptBuilder& Builder, const FProperty* Property, const FString& NativePropertyName, const FString& DestinationBuffer, const FString& Offset, const
@@ -106,19 +106,19 @@ void FArrayPropertyTranslator::ExportMarshalToNativeBuffer(FCSScriptBuilder& Bui
 	const FString InnerType = Handler.GetManagedType(InnerProperty);
 	const FString MarshallerType = FString::Printf(TEXT("ArrayCopyMarshaller<%s>"), *InnerType);
 
-	Builder.AppendLine(FString::Printf(TEXT("%s ??= new %s(%s, %s);"), *Marshaller, *MarshallerType, *NativeProperty, *Handler.ExportMarshallerDelegates(InnerProperty, NativePropertyName)));
+	Builder.AppendLinef(TEXT("%s ??= new %s(%s, %s);"), *Marshaller, *MarshallerType, *NativeProperty, *Handler.ExportMarshallerDelegates(InnerProperty, NativePropertyName));
 
 	//Native buffer variable used in cleanup
-	Builder.AppendLine(FString::Printf(TEXT("IntPtr %s_NativeBuffer = IntPtr.Add(%s, %s);"), *NativePropertyName, *DestinationBuffer, *Offset));
+	Builder.AppendLinef(TEXT("IntPtr %s_NativeBuffer = IntPtr.Add(%s, %s);"), *NativePropertyName, *DestinationBuffer, *Offset);
 
 	
-	Builder.AppendLine(FString::Printf(TEXT("%s.ToNative(%s_NativeBuffer, 0, %s);"), *Marshaller, *NativePropertyName, *Source));
+	Builder.AppendLinef(TEXT("%s.ToNative(%s_NativeBuffer, 0, %s);"), *Marshaller, *NativePropertyName, *Source);
 }
 
 void FArrayPropertyTranslator::ExportCleanupMarshallingBuffer(FCSScriptBuilder& Builder, const FProperty* ParamProperty, const FString& ParamName) const
 {
 	const FString Marshaller = ParamProperty->GetOwnerChecked<UFunction>()->GetName() + "_" + ParamName + "_Marshaller";
-	Builder.AppendLine(FString::Printf(TEXT("%s.DestructInstance(%s_NativeBuffer, 0);"), *Marshaller, *ParamName));
+	Builder.AppendLinef(TEXT("%s.DestructInstance(%s_NativeBuffer, 0);"), *Marshaller, *ParamName);
 }
 
 void FArrayPropertyTranslator::ExportMarshalFromNativeBuffer(FCSScriptBuilder& Builder, const FProperty* Property, const FString& NativePropertyName, const FString& AssignmentOrReturn, const FString& SourceBuffer, const FString& Offset, bool bCleanupSourceBuffer, bool reuseRefMarshallers) const
@@ -141,17 +141,17 @@ void FArrayPropertyTranslator::ExportMarshalFromNativeBuffer(FCSScriptBuilder& B
 
 	if (!reuseRefMarshallers)
 	{
-		Builder.AppendLine(FString::Printf(TEXT("%s ??= new %s(%s, %s);"), *Marshaller, *MarshallerType, *NativeProperty, *Handler.ExportMarshallerDelegates(InnerProperty, NativePropertyName)));
+		Builder.AppendLinef(TEXT("%s ??= new %s(%s, %s);"), *Marshaller, *MarshallerType, *NativeProperty, *Handler.ExportMarshallerDelegates(InnerProperty, NativePropertyName));
 
 		//Native buffer variable used in cleanup
-		Builder.AppendLine(FString::Printf(TEXT("IntPtr %s_NativeBuffer = IntPtr.Add(%s, %s);"), *NativePropertyName, *SourceBuffer, *Offset));
+		Builder.AppendLinef(TEXT("IntPtr %s_NativeBuffer = IntPtr.Add(%s, %s);"), *NativePropertyName, *SourceBuffer, *Offset);
 	}
 
-	Builder.AppendLine(FString::Printf(TEXT("%s %s.FromNative(%s_NativeBuffer, 0);"), *AssignmentOrReturn, *Marshaller, *NativePropertyName));
+	Builder.AppendLinef(TEXT("%s %s.FromNative(%s_NativeBuffer, 0);"), *AssignmentOrReturn, *Marshaller, *NativePropertyName);
 
 	if (bCleanupSourceBuffer)
 	{
-		Builder.AppendLine(FString::Printf(TEXT("%s.DestructInstance(%s_NativeBuffer, 0);"), *Marshaller, *NativePropertyName));
+		Builder.AppendLinef(TEXT("%s.DestructInstance(%s_NativeBuffer, 0);"), *Marshaller, *NativePropertyName);
 	}
 }
 
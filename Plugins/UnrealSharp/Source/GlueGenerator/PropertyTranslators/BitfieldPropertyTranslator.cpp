@@ -11,7 +11,7 @@ FBitfieldPropertyTranslator::FBitfieldPropertyTranslator(FCSPropertyTranslatorMa
 void FBitfieldPropertyTranslator::ExportPropertyStaticConstruction(FCSScriptBuilder& Builder, const FProperty* Property, const FString& NativePropertyName) const
 {
 	FPropertyTranslator::ExportPropertyStaticConstruction(Builder, Property, NativePropertyName);
-	Builder.AppendLine(FString::Printf(TEXT("%s_NativeProperty = %s.CallGetNativePropertyFromName(NativeClassPtr, \"%s\");"), *NativePropertyName, FPropertyCallbacks, *NativePropertyName));
+	MakeGetNativePropertyFromName(Builder, NativePropertyName);
 }
 
 bool FBitfieldPropertyTranslator::CanHandleProperty(const FProperty* Property) const
@@ -28,12 +28,12 @@ FString FBitfieldPropertyTranslator::GetManagedType(const FProperty* Property) c
 void FBitfieldPropertyTranslator::ExportPropertyVariables(FCSScriptBuilder& Builder, const FProperty* Property, const FString& NativePropertyName) const
 {
 	FPropertyTranslator::ExportPropertyVariables(Builder, Property, NativePropertyName);
-	Builder.AppendLine(FString::Printf(TEXT("static readonly IntPtr %s_NativeProperty;"), *NativePropertyName));
+	Builder.AppendLinef(TEXT("static readonly IntPtr %s_NativeProperty;"), *NativePropertyName);
 }
 
 void FBitfieldPropertyTranslator::ExportMarshalFromNativeBuffer(FCSScriptBuilder& Builder, const FProperty* Property, const FString& NativePropertyName, const FString& AssignmentOrReturn, const FString& SourceBuffer, const FString& Offset, bool bCleanupSourceBuffer, bool reuseRefMarshallers) const
 {
-	Builder.AppendLine(FString::Printf(TEXT("%s %s.CallGetBitfieldValueFromProperty(%s, %s_NativeProperty, %s);"), *AssignmentOrReturn, FBoolPropertyCallbacks, *SourceBuffer, *NativePropertyName, *Offset));
+	Builder.AppendLinef(TEXT("%s %s.CallGetBitfieldValueFromProperty(%s, %s_NativeProperty, %s);"), *AssignmentOrReturn, FBoolPropertyCallbacks, *SourceBuffer, *NativePropertyName, *Offset);
 }
 
 void FBitfieldPropertyTranslator::ExportCleanupMarshallingBuffer(FCSScriptBuilder& Builder, const FProperty* ParamProperty, const FString& ParamName) const
@@ -43,7 +43,7 @@ void FBitfieldPropertyTranslator::ExportCleanupMarshallingBuffer(FCSScriptBuilde
 
 void FBitfieldPropertyTranslator::ExportMarshalToNativeBuffer(FCSScriptBuilder& Builder, const FProperty* Property, const FString& NativePropertyName, const FString& DestinationBuffer, const FString& Offset, const FString& Source) const
 {
-	Builder.AppendLine(FString::Printf(TEXT("%s.CallSetBitfieldValueForProperty(%s, %s_NativeProperty, %s);"), FBoolPropertyCallbacks, *DestinationBuffer, *NativePropertyName, *Offset));
+	Builder.AppendLinef(TEXT("%s.CallSetBitfieldValueForProperty(%s, %s_NativeProperty, %s);"), FBoolPropertyCallbacks, *DestinationBuffer, *NativePropertyName, *Offset);
 }
 
 FString FBitfieldPropertyTranslator::GetNullReturnCSharpValue(const FProperty* ReturnProperty) const
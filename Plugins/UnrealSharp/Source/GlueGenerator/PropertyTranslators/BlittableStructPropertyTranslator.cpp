@@ -32,7 +32,7 @@ bool FBlittableStructPropertyTranslator::CanHandleProperty(const FProperty* Prop
 	check(StructProperty->Struct);
 	const UScriptStruct& Struct = *StructProperty->Struct;
 
-	return IsStructBlittable(PropertyHandlers, Struct);
+	return PropertyHandlers.IsStructBlittable(Struct);
 }
 
 FString FBlittableStructPropertyTranslator::GetManagedType(const FProperty* Property) const
@@ -3,7 +3,7 @@
 
 void FDelegateBasePropertyTranslator::ExportPropertyStaticConstruction(FCSScriptBuilder& Builder,const FProperty* Property, const FString& NativePropertyName) const
 {
-	Builder.AppendLine(FString::Printf(TEXT("%s_NativeProperty = %s.CallGetNativePropertyFromName(NativeClassPtr, \"%s\");"), *NativePropertyName, FPropertyCallbacks, *NativePropertyName));
+	MakeGetNativePropertyFromName(Builder, NativePropertyName);
 	FPropertyTranslator::ExportPropertyStaticConstruction(Builder, Property, NativePropertyName);
 }
 
@@ -52,7 +52,7 @@ void FMapPropertyTranslator::ExportParameterStaticConstruction(FCSScriptBuilder&
 {
 	FPropertyTranslator::ExportParameterStaticConstruction(Builder, NativeMethodName, Parameter);
 	const FString ParamName = Parameter->GetName();
-	Builder.AppendLine(FString::Printf(TEXT("%s_%s_NativeProperty = %s.CallGetNativePropertyFromName(%s_NativeFunction, \"%s\");"), *NativeMethodName, *ParamName, FPropertyCallbacks, *NativeMethodName, *ParamName));
+	Builder.AppendLinef(TEXT("%s_%s_NativeProperty = NativeLayout.GetProperty(\"%s.%s\");"), *NativeMethodName, *ParamName, *NativeMethodName, *ParamName);
 }
 
 FString FMapPropertyTranslator::ExportInstanceMarshallerVariables(const FProperty* Property, const FString& PropertyName) const
@@ -77,17 +77,17 @@ void FMapPropertyTranslator::ExportPropertyGetter(FCSScriptBuilder& Builder, con
 	FString Marshaller;
 	GetMarshaller(CastFieldChecked<FMapProperty>(Property), Marshaller);
 
-	Builder.AppendLine(FString::Printf(TEXT("%s_Marshaller ??= new %s(1, %s_NativeProperty, %s, %s);"),
+	Builder.AppendLinef(TEXT("%s_Marshaller ??= new %s(1, %s_NativeProperty, %s, %s);"),
 		*NativePropertyName,
 		*Marshaller,
 		*NativePropertyName,
 		*KeyHandler.ExportMarshallerDelegates(KeyProperty, NativePropertyName),
-		*ValueHandler.ExportMarshallerDelegates(ValueProperty, NativePropertyName)));
+		*ValueHandler.ExportMarshallerDelegates(ValueProperty, NativePropertyName));
 
 	Builder.AppendLine();
-	Builder.AppendLine(FString::Printf(TEXT("return %s_Marshaller.FromNative(IntPtr.Add(NativeObject,%s_Offset),0);"),
+	Builder.AppendLinef(TEXT("return %s_Marshaller.FromNative(IntPtr.Add(NativeObject,%s_Offset),0);"),
 		*NativePropertyName,
-		*NativePropertyName));
+		*NativePropertyName);
 }
 
 void FMapPropertyTranslator::ExportMarshalToNativeBuffer(FCSScriptBuilder& Builder, const FProperty* Property,
@@ -118,11 +118,11 @@ void FMapPropertyTranslator::ExportMarshalToNativeBuffer(FCSScriptBuilder& Build
 	FString KeyMarshaller = KeyHandler.ExportMarshallerDelegates(KeyProperty, PropertyName);
 	FString ValueMarshaller = ValueHandler.ExportMarshallerDelegates(ValueProperty, PropertyName);
 
-	Builder.AppendLine(FString::Printf(TEXT("%s ??= new %s(%s, %s, %s);"), *Marshaller, *MarshallerType, *NativeProperty, *KeyMarshaller, *ValueMarshaller));
+	Builder.AppendLinef(TEXT("%s ??= new %s(%s, %s, %s);"), *Marshaller, *MarshallerType, *NativeProperty, *KeyMarshaller, *ValueMarshaller);
 
 	//Native buffer variable used in cleanup
-	Builder.AppendLine(FString::Printf(TEXT("IntPtr %s_NativeBuffer = IntPtr.Add(%s, %s);"), *PropertyName, *DestinationBuffer, *Offset));
-	Builder.AppendLine(FString::Printf(TEXT("%s.ToNative(%s_NativeBuffer, 0, %s);"), *Marshaller, *PropertyName, *Source));
+	Builder.AppendLinef(TEXT("IntPtr %s_NativeBuffer = IntPtr.Add(%s, %s);"), *PropertyName, *DestinationBuffer, *Offset);
+	Builder.AppendLinef(TEXT("%s.ToNative(%s_NativeBuffer, 0, %s);"), *Marshaller, *PropertyName, *Source);
 }
 
 void FMapPropertyTranslator::ExportMarshalFromNativeBuffer(FCSScriptBuilder& Builder, const FProperty* Property,
@@ -154,17 +154,17 @@ void FMapPropertyTranslator::ExportMarshalFromNativeBuffer(FCSScriptBuilder& Bui
 		FString KeyMarshaller = KeyHandler.ExportMarshallerDelegates(KeyProperty, NativePropertyName);
 		FString ValueMarshaller = ValueHandler.ExportMarshallerDelegates(ValueProperty, NativePropertyName);
 		
-		Builder.AppendLine(FString::Printf(TEXT("%s ??= new %s(%s, %s, %s);"), *Marshaller, *MarshallerType, *NativeProperty, *KeyMarshaller, *ValueMarshaller));
+		Builder.AppendLinef(TEXT("%s ??= new %s(%s, %s, %s);"), *Marshaller, *MarshallerType, *NativeProperty, *KeyMarshaller, *ValueMarshaller);
 
 		//Native buffer variable used in cleanup
-		Builder.AppendLine(FString::Printf(TEXT("IntPtr %s_NativeBuffer = IntPtr.Add(%s, %s);"), *NativePropertyName, *SourceBuffer, *Offset));
+		Builder.AppendLinef(TEXT("IntPtr %s_NativeBuffer = IntPtr.Add(%s, %s);"), *NativePropertyName, *SourceBuffer, *Offset);
 	}
 
-	Builder.AppendLine(FString::Printf(TEXT("%s %s.FromNative(%s_NativeBuffer, 0);"), *AssignmentOrReturn, *Marshaller, *NativePropertyName));
+	Builder.AppendLinef(TEXT("%s %s.FromNative(%s_NativeBuffer, 0);"), *AssignmentOrReturn, *Marshaller, *NativePropertyName);
 
 	if (bCleanupSourceBuffer)
 	{
-		Builder.AppendLine(FString::Printf(TEXT("%s.DestructInstance(%s_NativeBuffer, 0);"), *Marshaller, *NativePropertyName));
+		Builder.AppendLinef(TEXT("%s.DestructInstance(%s_NativeBuffer, 0);"), *Marshaller, *NativePropertyName);
 	}
 }
 
@@ -181,14 +181,14 @@ void FMapPropertyTranslator::ExportParameterVariables(FCSScriptBuilder& Builder,
 	FString Marshaller;
 	GetMarshaller(CastFieldChecked<FMapProperty>(ParamProperty), Marshaller);
 	
-	Builder.AppendLine(FString::Printf(TEXT("static IntPtr %s_%s_NativeProperty;"), *NativeMethodName, *NativePropertyName));
+	Builder.AppendLinef(TEXT("static IntPtr %s_%s_NativeProperty;"), *NativeMethodName, *NativePropertyName);
 	if (Function->HasAnyFunctionFlags(FUNC_Static))
 	{
-		Builder.AppendLine(FString::Printf(TEXT("static %s %s_%s_Marshaller = null;"), *Marshaller, *NativeMethodName, *NativePropertyName));
+		Builder.AppendLinef(TEXT("static %s %s_%s_Marshaller = null;"), *Marshaller, *NativeMethodName, *NativePropertyName);
 	}
 	else
 	{
-		Builder.AppendLine(FString::Printf(TEXT("%s %s_%s_Marshaller = null;"), *Marshaller, *NativeMethodName, *NativePropertyName));
+		Builder.AppendLinef(TEXT("%s %s_%s_Marshaller = null;"), *Marshaller, *NativeMethodName, *NativePropertyName);
 	}
 }
 
@@ -202,11 +202,11 @@ void FMapPropertyTranslator::ExportPropertyVariables(FCSScriptBuilder& Builder,
 	
 	if (IsOwnedBy<UScriptStruct>(Property))
 	{
-		Builder.AppendLine(FString::Printf(TEXT("static %s %s_Marshaller = null;"), *Marshaller, *PropertyName));
+		Builder.AppendLinef(TEXT("static %s %s_Marshaller = null;"), *Marshaller, *PropertyName);
 	}
 	else
 	{
-		Builder.AppendLine(FString::Printf(TEXT("%s %s_Marshaller = null;"), *Marshaller, *PropertyName));
+		Builder.AppendLinef(TEXT("%s %s_Marshaller = null;"), *Marshaller, *PropertyName);
 	}
 }
 
@@ -36,7 +36,7 @@ void FMulticastDelegatePropertyTranslator::ExportPropertyStaticConstruction(FCSS
 	{
 		FString DelegateName = GetDelegateName(DelegateProperty);
 		FString Namespace = FCSGenerator::Get().GetNamespace(DelegateProperty->SignatureFunction);
-		Builder.AppendLine(FString::Printf(TEXT("%s.%s.InitializeUnrealDelegate(%s_NativeProperty);"), *Namespace, *DelegateName, *NativePropertyName));
+		Builder.AppendLinef(TEXT("%s.%s.InitializeUnrealDelegate(%s_NativeProperty);"), *Namespace, *DelegateName, *NativePropertyName);
 	}
 }
 
@@ -46,7 +46,7 @@ void FMulticastDelegatePropertyTranslator::ExportPropertyVariables(FCSScriptBuil
 
 	FString BackingFieldName = GetBackingFieldName(Property);
 	FString DelegateName = GetDelegateName(CastFieldChecked<FMulticastDelegateProperty>(Property));
-	Builder.AppendLine(FString::Printf(TEXT("private %s %s;"), *DelegateName, *BackingFieldName));
+	Builder.AppendLinef(TEXT("private %s %s;"), *DelegateName, *BackingFieldName);
 	
 	FPropertyTranslator::ExportPropertyVariables(Builder, Property, PropertyName);
 }
@@ -56,12 +56,12 @@ void FMulticastDelegatePropertyTranslator::ExportPropertySetter(FCSScriptBuilder
 	FString BackingFieldName = GetBackingFieldName(Property);
 	FString DelegateName = GetDelegateName(CastFieldChecked<FMulticastDelegateProperty>(Property));
 
-	Builder.AppendLine(FString::Printf(TEXT("if (value == %s)"), *BackingFieldName));
+	Builder.AppendLinef(TEXT("if (value == %s)"), *BackingFieldName);
 	Builder.OpenBrace();
 	Builder.AppendLine("return;");
 	Builder.CloseBrace();
-	Builder.AppendLine(FString::Printf(TEXT("%s = value;"), *BackingFieldName));
-	Builder.AppendLine(FString::Printf(TEXT("DelegateMarshaller<%s>.ToNative(IntPtr.Add(NativeObject,%s_Offset),0,value);"), *DelegateName, *PropertyName));
+	Builder.AppendLinef(TEXT("%s = value;"), *BackingFieldName);
+	Builder.AppendLinef(TEXT("DelegateMarshaller<%s>.ToNative(IntPtr.Add(NativeObject,%s_Offset),0,value);"), *DelegateName, *PropertyName);
 }
 
 void FMulticastDelegatePropertyTranslator::ExportPropertyGetter(FCSScriptBuilder& Builder, const FProperty* Property, const FString& PropertyName) const
@@ -70,12 +70,12 @@ void FMulticastDelegatePropertyTranslator::ExportPropertyGetter(FCSScriptBuilder
 	FString NativePropertyFieldName = GetNativePropertyField(PropertyName);
 	FString DelegateName = GetDelegateName(CastFieldChecked<FMulticastDelegateProperty>(Property));
 	
-	Builder.AppendLine(FString::Printf(TEXT("if (%s == null)"), *BackingFieldName));
+	Builder.AppendLinef(TEXT("if (%s == null)"), *BackingFieldName);
 	Builder.OpenBrace();
-	Builder.AppendLine(FString::Printf(TEXT("%s = DelegateMarshaller<%s>.FromNative(IntPtr.Add(NativeObject, %s_Offset), %s, 0);"),
-		*BackingFieldName, GetData(DelegateName), GetData(PropertyName), *NativePropertyFieldName));
+	Builder.AppendLinef(TEXT("%s = DelegateMarshaller<%s>.FromNative(IntPtr.Add(NativeObject, %s_Offset), %s, 0);"),
+		*BackingFieldName, GetData(DelegateName), GetData(PropertyName), *NativePropertyFieldName);
 	Builder.CloseBrace();
-	Builder.AppendLine(FString::Printf(TEXT("return %s;"), *BackingFieldName));
+	Builder.AppendLinef(TEXT("return %s;"), *BackingFieldName);
 }
 
 FString FMulticastDelegatePropertyTranslator::GetNullReturnCSharpValue(const FProperty* ReturnProperty) const
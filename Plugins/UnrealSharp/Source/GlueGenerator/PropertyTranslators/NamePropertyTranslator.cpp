@@ -16,10 +16,10 @@ void FNamePropertyTranslator::ExportCppDefaultParameterAsLocalVariable(FCSScript
 {
 	if (CppDefaultValue == "None")
 	{
-		Builder.AppendLine(FString::Printf(TEXT("Name %s = Name.None;"), *VariableName));
+		Builder.AppendLinef(TEXT("Name %s = Name.None;"), *VariableName);
 	}
 	else
 	{
-		Builder.AppendLine(FString::Printf(TEXT("Name %s = new Name(\"%s\");"), *VariableName, *CppDefaultValue));
+		Builder.AppendLinef(TEXT("Name %s = new Name(\"%s\");"), *VariableName, *CppDefaultValue);
 	}
 }
\ No newline at end of file
@@ -34,7 +34,7 @@ FString FSimpleTypePropertyTranslator::ConvertCppDefaultParameterToCSharp(const
 
 void FSimpleTypePropertyTranslator::ExportMarshalToNativeBuffer(FCSScriptBuilder& Builder, const FProperty* Property, const FString& NativePropertyName, const FString& DestinationBuffer, const FString& Offset, const FString& Source) const
 {
-	Builder.AppendLine(FString::Printf(TEXT("%s.ToNative(IntPtr.Add(%s, %s), 0, %s);"), *GetMarshaller(Property), *DestinationBuffer, *Offset, *Source));
+	Builder.AppendLinef(TEXT("%s.ToNative(IntPtr.Add(%s, %s), 0, %s);"), *GetMarshaller(Property), *DestinationBuffer, *Offset, *Source);
 }
 
 void FSimpleTypePropertyTranslator::ExportCleanupMarshallingBuffer(FCSScriptBuilder& Builder, const FProperty* ParamProperty, const FString& ParamName) const
@@ -58,7 +58,7 @@ FString FSimpleTypePropertyTranslator::GetMarshaller(const FProperty *Property)
 void FSimpleTypePropertyTranslator::ExportMarshalFromNativeBuffer(FCSScriptBuilder& Builder, const FProperty* Property, const FString& NativePropertyName, const FString& AssignmentOrReturn, const FString& SourceBuffer, const FString& Offset, bool bCleanupSourceBuffer, bool reuseRefMarshallers) const
 {
 	// The returned handle is just a pointer to the return value memory in the parameter buffer.
-	Builder.AppendLine(FString::Printf(TEXT("%s %s.FromNative(IntPtr.Add(%s, %s), 0);"), *AssignmentOrReturn, *GetMarshaller(Property), *SourceBuffer, *Offset));
+	Builder.AppendLinef(TEXT("%s %s.FromNative(IntPtr.Add(%s, %s), 0);"), *AssignmentOrReturn, *GetMarshaller(Property), *SourceBuffer, *Offset);
 }
 
 void FSimpleTypePropertyTranslator::ExportDefaultStructParameter(FCSScriptBuilder& Builder, const FString& VariableName, const FString& CppDefaultValue, FProperty* ParamProperty, const FPropertyTranslator& Handler) const
@@ -88,7 +88,7 @@ void FSimpleTypePropertyTranslator::ExportDefaultStructParameter(FCSScriptBuilde
 	}
 
 	FString FoundCSharpType = Handler.GetManagedType(ParamProperty);
-	Builder.AppendLine(FString::Printf(TEXT("%s %s = new %s"), *FoundCSharpType, *VariableName, *FoundCSharpType));
+	Builder.AppendLinef(TEXT("%s %s = new %s"), *FoundCSharpType, *VariableName, *FoundCSharpType);
 	Builder.AppendLine(TEXT("{"));
 	Builder.Indent();
 
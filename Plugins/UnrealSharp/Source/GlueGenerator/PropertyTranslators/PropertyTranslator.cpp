@@ -107,7 +107,7 @@ void FPropertyTranslator::ExportWrapperProperty(FCSScriptBuilder& Builder, const
 	FString CSharpPropertyName = GetScriptNameMapper().MapPropertyName(Property, ReservedNames);
 	FString NativePropertyName = GetPropertyName(Property);
 
-	Builder.AppendLine(FString::Printf(TEXT("// %s"), *Property->GetFullName()));
+	Builder.AppendLinef(TEXT("// %s"), *Property->GetFullName());
 	ExportPropertyVariables(Builder, Property, NativePropertyName);
 	
 	FString Protection;
@@ -134,12 +134,12 @@ void FPropertyTranslator::ExportWrapperProperty(FCSScriptBuilder& Builder, const
 		Builder.AppendLine(TEXT("get"));
 		Builder.OpenBrace();
 		Builder.BeginUnsafeBlock();
-		Builder.AppendLine(FString::Printf(TEXT("if (%s_Wrapper == null)"), *NativePropertyName));
+		Builder.AppendLinef(TEXT("if (%s_Wrapper == null)"), *NativePropertyName);
 		Builder.OpenBrace();
 		Builder.AppendLine(ExportInstanceMarshallerVariables(Property, NativePropertyName));
-		Builder.AppendLine(FString::Printf(TEXT("%s_Wrapper = new %s (this, %s_Offset, %s_Length, %s);"), *NativePropertyName, *GetCSharpFixedSizeArrayType(Property), *NativePropertyName, *NativePropertyName, *ExportMarshallerDelegates(Property, NativePropertyName)));
+		Builder.AppendLinef(TEXT("%s_Wrapper = new %s (this, %s_Offset, %s_Length, %s);"), *NativePropertyName, *GetCSharpFixedSizeArrayType(Property), *NativePropertyName, *NativePropertyName, *ExportMarshallerDelegates(Property, NativePropertyName));
 		Builder.CloseBrace();
-		Builder.AppendLine(FString::Printf(TEXT("return %s_Wrapper;"), *NativePropertyName));
+		Builder.AppendLinef(TEXT("return %s_Wrapper;"), *NativePropertyName);
 		Builder.EndUnsafeBlock();
 		Builder.CloseBrace();
 	}
@@ -167,7 +167,7 @@ void FPropertyTranslator::BeginWrapperPropertyAccessorBlock(FCSScriptBuilder& Bu
 	Builder.AppendLine();
 	AppendTooltip(Property, Builder);
 	const FString PropertyType = Property->ArrayDim == 1 ? GetManagedType(Property) : GetCSharpFixedSizeArrayType(Property);
-	Builder.AppendLine(FString::Printf(TEXT("%s%s %s"), GetData(Protection), *PropertyType, *PropertyName));
+	Builder.AppendLinef(TEXT("%s%s %s"), GetData(Protection), *PropertyType, *PropertyName);
 	Builder.OpenBrace();
 }
 
@@ -181,7 +181,7 @@ void FPropertyTranslator::ExportMirrorProperty(FCSScriptBuilder& Builder, const
 	FString CSharpPropertyName = GetScriptNameMapper().MapPropertyName(Property, ReservedNames);
 	FString NativePropertyName = Property->GetName();
 
-	Builder.AppendLine(FString::Printf(TEXT("// %s"), *Property->GetFullName()));
+	Builder.AppendLinef(TEXT("// %s"), *Property->GetFullName());
 	Builder.AppendLine();
 
 	if (!bSuppressOffsets)
@@ -193,7 +193,7 @@ void FPropertyTranslator::ExportMirrorProperty(FCSScriptBuilder& Builder, const
 	GetPropertyProtection(Property, Protection);
 
 	AppendTooltip(Property, Builder);
-	Builder.AppendLine(FString::Printf(TEXT("%s%s %s;"), GetData(Protection), *GetManagedType(Property), *CSharpPropertyName));
+	Builder.AppendLinef(TEXT("%s%s %s;"), GetData(Protection), *GetManagedType(Property), *CSharpPropertyName);
 
 	ExportReferences(Property);
 	ExportDelegateReferences(Property);
@@ -202,24 +202,23 @@ void FPropertyTranslator::ExportMirrorProperty(FCSScriptBuilder& Builder, const
 
 void FPropertyTranslator::ExportPropertyStaticConstruction(FCSScriptBuilder& Builder, const FProperty* Property, const FString& NativePropertyName) const
 {
-	Builder.AppendLine(FString::Printf(TEXT("%s_Offset = %s.CallGetPropertyOffsetFromName(NativeClassPtr, \"%s\");"), *NativePropertyName, FPropertyCallbacks, *NativePropertyName));
+	Builder.AppendLinef(TEXT("%s_Offset = NativeLayout.GetOffset(\"%s\");"), *NativePropertyName, *NativePropertyName);
 
 	if (Property->ArrayDim > 1)
 	{
 		check(IsSupportedInStaticArray());
-		Builder.AppendLine(FString::Printf(TEXT("%s_Length = %s.CallGetPropertyArrayDimFromName(NativeClassPtr, \"%s\");"), *NativePropertyName, FPropertyCallbacks, *NativePropertyName));
+		Builder.AppendLinef(TEXT("%s_Length = NativeLayout.GetArrayDim(\"%s\");"), *NativePropertyName, *NativePropertyName);
 	}
 }
 
 void FPropertyTranslator::ExportParameterStaticConstruction(FCSScriptBuilder& Builder, const FString& NativeMethodName, const FProperty* Parameter) const
 {
 	const FString ParamName = Parameter->GetName();
-	Builder.AppendLine(FString::Printf(TEXT("%s_%s_Offset = %s.CallGetPropertyOffsetFromName(%s_NativeFunction, \"%s\");"),
+	Builder.AppendLinef(TEXT("%s_%s_Offset = NativeLayout.GetOffset(\"%s.%s\");"),
 		*NativeMethodName,
 		*ParamName,
-		FPropertyCallbacks,
 		*NativeMethodName,
-		*ParamName));
+		*ParamName);
 }
 
 FPropertyTranslator::FunctionExporter::FunctionExporter(const FPropertyTranslator& InHandler, UFunction& InFunction, ProtectionMode InProtectionMode, OverloadMode InOverloadMode, BlueprintVisibility InBlueprintVisibility)
@@ -477,12 +476,12 @@ void FPropertyTranslator::FunctionExporter::Initialize(ProtectionMode InProtecti
 void FPropertyTranslator::FunctionExporter::ExportFunctionVariables(FCSScriptBuilder& Builder) const
 {
 	const FString NativeMethodName = Function.GetName();
-	Builder.AppendLine(FString::Printf(TEXT("// Function %s"), *Function.GetPathName()));
-	Builder.AppendLine(FString::Printf(TEXT("%sIntPtr %s_NativeFunction;"), !bBlueprintEvent ? TEXT("static ") : TEXT(""), *NativeMethodName));
+	Builder.AppendLinef(TEXT("// Function %s"), *Function.GetPathName());
+	Builder.AppendLinef(TEXT("%sIntPtr %s_NativeFunction;"), !bBlueprintEvent ? TEXT("static ") : TEXT(""), *NativeMethodName);
 
 	if (Function.NumParms > 0)
 	{
-		Builder.AppendLine(FString::Printf(TEXT("static int %s_ParamsSize;"), *NativeMethodName));
+		Builder.AppendLinef(TEXT("static int %s_ParamsSize;"), *NativeMethodName);
 	}
 
 	for (TFieldIterator<FProperty> ParamIt(&Function); ParamIt; ++ParamIt)
@@ -500,13 +499,13 @@ void FPropertyTranslator::FunctionExporter::ExportOverloads(FCSScriptBuilder& Bu
 		Builder.AppendLine();
 		AppendTooltip(&Function, Builder);
 		ExportDeprecation(Builder);
-		Builder.AppendLine(FString::Printf(TEXT("%s%s %s(%s)"), *Modifiers, *Handler.GetManagedType(ReturnProperty), *CSharpMethodName, *Overload.ParamsStringAPIWithDefaults));
+		Builder.AppendLinef(TEXT("%s%s %s(%s)"), *Modifiers, *Handler.GetManagedType(ReturnProperty), *CSharpMethodName, *Overload.ParamsStringAPIWithDefaults);
 		Builder.OpenBrace();
 
 		FString ReturnStatement = ReturnProperty ? "return " : "";
 
 		Overload.ParamHandler->ExportCppDefaultParameterAsLocalVariable(Builder, *Overload.CSharpParamName, Overload.CppDefaultValue, &Function, Overload.ParamProperty);
-		Builder.AppendLine(FString::Printf(TEXT("%s%s(%s);"), *ReturnStatement, *CSharpMethodName, *Overload.ParamsStringCall));
+		Builder.AppendLinef(TEXT("%s%s(%s);"), *ReturnStatement, *CSharpMethodName, *Overload.ParamsStringCall);
 
 		Builder.CloseBrace();
 	}
@@ -539,17 +538,17 @@ void FPropertyTranslator::FunctionExporter::ExportExtensionMethod(FCSScriptBuild
 	Builder.AppendLine();
 	AppendTooltip(&Function, Builder);
 	ExportDeprecation(Builder);
-	Builder.AppendLine(FString::Printf(TEXT("%s%s %s(%s)"), *Modifiers, *Handler.GetManagedType(ReturnProperty), *CSharpMethodName, *ParamsStringAPIWithDefaults));
+	Builder.AppendLinef(TEXT("%s%s %s(%s)"), *Modifiers, *Handler.GetManagedType(ReturnProperty), *CSharpMethodName, *ParamsStringAPIWithDefaults);
 	Builder.OpenBrace();
 	FString ReturnStatement = ReturnProperty ? TEXT("return ") : TEXT("");
 	UClass* OriginalClass = Function.GetOuterUClass();
-	Builder.AppendLine(FString::Printf(TEXT("%s%s.%s(%s);"), *ReturnStatement, *GetScriptNameMapper().GetQualifiedName(OriginalClass), *CSharpMethodName, *ParamsStringCall));
+	Builder.AppendLinef(TEXT("%s%s.%s(%s);"), *ReturnStatement, *GetScriptNameMapper().GetQualifiedName(OriginalClass), *CSharpMethodName, *ParamsStringCall);
 	Builder.CloseBrace();
 }
 
 void FPropertyTranslator::FunctionExporter::ExportSignature(FCSScriptBuilder& Builder, const FString& Protection) const
 {
-	Builder.AppendLine(FString::Printf(TEXT("%s%s %s(%s)"), *Protection, ReturnProperty ? *Handler.GetManagedType(ReturnProperty) : TEXT("void"), *CSharpMethodName, *ParamsStringAPIWithDefaults));
+	Builder.AppendLinef(TEXT("%s%s %s(%s)"), *Protection, ReturnProperty ? *Handler.GetManagedType(ReturnProperty) : TEXT("void"), *CSharpMethodName, *ParamsStringAPIWithDefaults);
 }
 
 void FPropertyTranslator::FunctionExporter::ExportGetter(FCSScriptBuilder& Builder) const
@@ -573,7 +572,7 @@ void FPropertyTranslator::FunctionExporter::ExportSetter(FCSScriptBuilder& Build
 	check(Function.NumParms == 1);
 
 	Builder.AppendLine();
-	Builder.AppendLine(FString::Printf(TEXT("%s set"), bProtected?TEXT("protected "):TEXT("")));
+	Builder.AppendLinef(TEXT("%s set"), bProtected?TEXT("protected "):TEXT(""));
 	Builder.OpenBrace();
 	Builder.BeginUnsafeBlock();
 	ExportInvoke(Builder, InvokeMode::Setter);
@@ -590,9 +589,9 @@ void FPropertyTranslator::FunctionExporter::ExportInvoke(FCSScriptBuilder& Build
 	if (bBlueprintEvent)
 	{
 		// Lazy-init the instance function pointer.
-		Builder.AppendLine(FString::Printf(TEXT("if (%s == IntPtr.Zero)"), *NativeFunctionVariableName));
+		Builder.AppendLinef(TEXT("if (%s == IntPtr.Zero)"), *NativeFunctionVariableName);
 		Builder.OpenBrace();
-		Builder.AppendLine(FString::Printf(TEXT("%s = UClassExporter.CallGetNativeFunctionFromInstanceAndName(NativeObject, \"%s\");"), *NativeFunctionVariableName, *NativeMethodName));
+		Builder.AppendLinef(TEXT("%s = UClassExporter.CallGetNativeFunctionFromInstanceAndName(NativeObject, \"%s\");"), *NativeFunctionVariableName, *NativeMethodName);
 		Builder.CloseBrace();
 	}
 	
@@ -600,7 +599,7 @@ void FPropertyTranslator::FunctionExporter::ExportInvoke(FCSScriptBuilder& Build
 	{
 		if (CustomInvoke.IsEmpty())
 		{
-			Builder.AppendLine(FString::Printf(TEXT("%s(%s, %s, IntPtr.Zero);"), *PinvokeFunction, *PinvokeFirstArg, *NativeFunctionVariableName));
+			Builder.AppendLinef(TEXT("%s(%s, %s, IntPtr.Zero);"), *PinvokeFunction, *PinvokeFirstArg, *NativeFunctionVariableName);
 		}
 		else
 		{
@@ -609,9 +608,9 @@ void FPropertyTranslator::FunctionExporter::ExportInvoke(FCSScriptBuilder& Build
 	}
 	else
 	{
-		Builder.AppendLine(FString::Printf(TEXT("byte* ParamsBufferAllocation = stackalloc byte[%s_ParamsSize];"), *NativeMethodName));
+		Builder.AppendLinef(TEXT("byte* ParamsBufferAllocation = stackalloc byte[%s_ParamsSize];"), *NativeMethodName);
 		Builder.AppendLine(TEXT("nint ParamsBuffer = (IntPtr) ParamsBufferAllocation;"));
-		Builder.AppendLine(FString::Printf(TEXT("%s.%s(%s, ParamsBuffer);"), UStructCallbacks, TEXT("CallInitializeStruct"), *NativeFunctionVariableName));
+		Builder.AppendLinef(TEXT("%s.%s(%s, ParamsBuffer);"), UStructCallbacks, TEXT("CallInitializeStruct"), *NativeFunctionVariableName);
 		
 		for (TFieldIterator<FProperty> ParamIt(&Function); ParamIt; ++ParamIt)
 		{
@@ -635,7 +634,7 @@ void FPropertyTranslator::FunctionExporter::ExportInvoke(FCSScriptBuilder& Build
 		
 		if (CustomInvoke.IsEmpty())
 		{
-			Builder.AppendLine(FString::Printf(TEXT("%s(%s, %s_NativeFunction, ParamsBuffer);"), *PinvokeFunction, *PinvokeFirstArg, *NativeMethodName));
+			Builder.AppendLinef(TEXT("%s(%s, %s_NativeFunction, ParamsBuffer);"), *PinvokeFunction, *PinvokeFirstArg, *NativeMethodName);
 		}
 		else
 		{
@@ -657,7 +656,7 @@ void FPropertyTranslator::FunctionExporter::ExportInvoke(FCSScriptBuilder& Build
 					FString MarshalDestination;
 					if (ParamProperty->HasAnyPropertyFlags(CPF_ReturnParm))
 					{
-						Builder.AppendLine(FString::Printf(TEXT("%s returnValue;"), *Handler.GetManagedType(ReturnProperty)));
+						Builder.AppendLinef(TEXT("%s returnValue;"), *Handler.GetManagedType(ReturnProperty));
 						MarshalDestination = "returnValue";
 					}
 					else
@@ -706,7 +705,7 @@ void FPropertyTranslator::FunctionExporter::ExportDeprecation(FCSScriptBuilder&
 		{
 			DeprecationMessage = "This function is obsolete";
 		}
-		Builder.AppendLine(FString::Printf(TEXT("[Obsolete(\"%s\")]"), *DeprecationMessage));
+		Builder.AppendLinef(TEXT("[Obsolete(\"%s\")]"), *DeprecationMessage);
 	}
 }
 
@@ -825,7 +824,7 @@ void FPropertyTranslator::ExportOverridableFunction(FCSScriptBuilder& Builder, U
 
 	Builder.AppendLine(TEXT("//Hide implementation function from Intellisense/ReSharper"));
 	Builder.AppendLine(TEXT("[System.ComponentModel.EditorBrowsable(System.ComponentModel.EditorBrowsableState.Never)]"));
-	Builder.AppendLine(FString::Printf(TEXT("protected virtual %s %s_Implementation(%s)"), *GetManagedType(ReturnProperty), *NativeMethodName, *ParamsStringAPI));
+	Builder.AppendLinef(TEXT("protected virtual %s %s_Implementation(%s)"), *GetManagedType(ReturnProperty), *NativeMethodName, *ParamsStringAPI);
 	Builder.OpenBrace();
 
 	// Out params must be initialized before we return, since there may not be any override to do it.
@@ -837,19 +836,19 @@ void FPropertyTranslator::ExportOverridableFunction(FCSScriptBuilder& Builder, U
 			const FPropertyTranslator& ParamHandler = PropertyHandlers.Find(ParamProperty);
 			FString CSharpParamName = GetScriptNameMapper().MapParameterName(ParamProperty);
 			FString CSharpDefaultValue = ParamHandler.GetNullReturnCSharpValue(ParamProperty);
-			Builder.AppendLine(FString::Printf(TEXT("%s = %s;"), *CSharpParamName, *CSharpDefaultValue));
+			Builder.AppendLinef(TEXT("%s = %s;"), *CSharpParamName, *CSharpDefaultValue);
 		}
 	}
 	
 	if (ReturnProperty)
 	{
-		Builder.AppendLine(FString::Printf(TEXT("return %s;"), *GetNullReturnCSharpValue(ReturnProperty)));
+		Builder.AppendLinef(TEXT("return %s;"), *GetNullReturnCSharpValue(ReturnProperty));
 	}
 	
 	Builder.CloseBrace(); // Function
 
 	// Export the native invoker
-	Builder.AppendLine(FString::Printf(TEXT("void Invoke_%s(IntPtr buffer, IntPtr returnBuffer)"), *NativeMethodName));
+	Builder.AppendLinef(TEXT("void Invoke_%s(IntPtr buffer, IntPtr returnBuffer)"), *NativeMethodName);
 	Builder.OpenBrace();
 	Builder.BeginUnsafeBlock();
 
@@ -867,7 +866,7 @@ void FPropertyTranslator::ExportOverridableFunction(FCSScriptBuilder& Builder, U
 		}
 		else if (!ParamProperty->HasAnyPropertyFlags(CPF_ConstParm) && ParamProperty->HasAnyPropertyFlags(CPF_OutParm))
 		{
-			Builder.AppendLine(FString::Printf(TEXT("%s %s = default;"), *ParamType, *CSharpParamName));
+			Builder.AppendLinef(TEXT("%s %s = default;"), *ParamType, *CSharpParamName);
 		}
 		else
 		{
@@ -883,7 +882,7 @@ void FPropertyTranslator::ExportOverridableFunction(FCSScriptBuilder& Builder, U
 		}
 	}
 	
-	Builder.AppendLine(FString::Printf(TEXT("%s%s_Implementation(%s);"), *ReturnAssignment, *NativeMethodName, *ParamsCallString));
+	Builder.AppendLinef(TEXT("%s%s_Implementation(%s);"), *ReturnAssignment, *NativeMethodName, *ParamsCallString);
 
 	if (ReturnProperty)
 	{
@@ -936,7 +935,7 @@ void FPropertyTranslator::ExportDelegateFunction(FCSScriptBuilder& Builder, UFun
 	const FString ReturnType = *GetManagedType(ReturnProperty);
 
 	// Write signature delegate
-	Builder.AppendLine(FString::Printf(TEXT("public delegate %s Signature(%s);"), *ReturnType, *Exporter.ParamsStringAPIWithDefaults));
+	Builder.AppendLinef(TEXT("public delegate %s Signature(%s);"), *ReturnType, *Exporter.ParamsStringAPIWithDefaults);
 	Builder.AppendLine();
 
 	// Write fields needed for native invoker
@@ -944,7 +943,7 @@ void FPropertyTranslator::ExportDelegateFunction(FCSScriptBuilder& Builder, UFun
 	Builder.AppendLine();
 
 	// Write native invoker
-	Builder.AppendLine(FString::Printf(TEXT("protected %s Invoker(%s)"), *ReturnType, *Exporter.ParamsStringAPIWithDefaults));
+	Builder.AppendLinef(TEXT("protected %s Invoker(%s)"), *ReturnType, *Exporter.ParamsStringAPIWithDefaults);
 	Builder.OpenBrace();
 	Builder.BeginUnsafeBlock();
 	Exporter.ExportInvoke(Builder, FunctionExporter::InvokeMode::Normal);
@@ -954,17 +953,17 @@ void FPropertyTranslator::ExportDelegateFunction(FCSScriptBuilder& Builder, UFun
 
 void FPropertyTranslator::MakeNativePropertyField(FCSScriptBuilder& Builder, const FString& PropertyName) const
 {
-	Builder.AppendLine(FString::Printf(TEXT("static IntPtr %s_NativeProperty;"), *PropertyName));
+	Builder.AppendLinef(TEXT("static IntPtr %s_NativeProperty;"), *PropertyName);
 }
 
 void FPropertyTranslator::MakeGetNativePropertyFromName(FCSScriptBuilder& Builder, const FString& PropertyName) const
 {
-	Builder.AppendLine(FString::Printf(TEXT("%s_NativeProperty = %s.CallGetNativePropertyFromName(NativeClassPtr, \"%s\");"), *PropertyName, FPropertyCallbacks,  *PropertyName));
+	Builder.AppendLinef(TEXT("%s_NativeProperty = NativeLayout.GetProperty(\"%s\");"), *PropertyName, *PropertyName);
 }
 
 void FPropertyTranslator::AddNativePropertyField(FCSScriptBuilder& Builder, const FString& PropertyName)
 {
-	Builder.AppendLine(FString::Printf(TEXT("static IntPtr %s;"), *GetNativePropertyField(PropertyName)));
+	Builder.AppendLinef(TEXT("static IntPtr %s;"), *GetNativePropertyField(PropertyName));
 }
 
 FString FPropertyTranslator::GetNativePropertyField(const FString& PropertyName)
@@ -981,11 +980,11 @@ void FPropertyTranslator::ExportInterfaceFunction(FCSScriptBuilder& Builder, UFu
 
 void FPropertyTranslator::ExportPropertyVariables(FCSScriptBuilder& Builder, const FProperty* Property, const FString& NativePropertyName) const
 {
-	Builder.AppendLine(FString::Printf(TEXT("static int %s_Offset;"), *NativePropertyName));
+	Builder.AppendLinef(TEXT("static int %s_Offset;"), *NativePropertyName);
 	if (Property->ArrayDim > 1)
 	{
-		Builder.AppendLine(FString::Printf(TEXT("static int %s_Length;"), *NativePropertyName));
-		Builder.AppendLine(FString::Printf(TEXT("%s %s_Wrapper;"), *GetCSharpFixedSizeArrayType(Property), *NativePropertyName));
+		Builder.AppendLinef(TEXT("static int %s_Length;"), *NativePropertyName);
+		Builder.AppendLinef(TEXT("%s %s_Wrapper;"), *GetCSharpFixedSizeArrayType(Property), *NativePropertyName);
 	}
 }
 
@@ -1023,7 +1022,7 @@ void FPropertyTranslator::ExportPropertySetter(FCSScriptBuilder& Builder, const
 void FPropertyTranslator::ExportFunctionReturnStatement(FCSScriptBuilder& Builder, const UFunction* Function, const FProperty* ReturnProperty, const FString& NativeFunctionName, const FString& ParamsCallString) const
 {
 	const FString ReturnStatement = nullptr == ReturnProperty ? "" : "return ";
-	Builder.AppendLine(FString::Printf(TEXT("%sInvoke_%s(NativeObject, %s_NativeFunction%s);"), GetData(ReturnStatement), *NativeFunctionName, *NativeFunctionName, *ParamsCallString));
+	Builder.AppendLinef(TEXT("%sInvoke_%s(NativeObject, %s_NativeFunction%s);"), GetData(ReturnStatement), *NativeFunctionName, *NativeFunctionName, *ParamsCallString);
 }
 
 void FPropertyTranslator::ExportMarshalToNativeBuffer(FCSScriptBuilder& Builder, const FProperty* Property, const FString& NativePropertyName, const FString& DestinationBuffer, const FString& Offset, const FString& Source) const
@@ -1073,5 +1072,5 @@ FString FPropertyTranslator::ExportMarshallerDelegates(const FProperty *Property
 
 void FPropertyTranslator:: ExportParameterVariables(FCSScriptBuilder& Builder, UFunction* Function, const FString& NativeMethodName, FProperty* ParamProperty, const FString& NativePropertyName) const
 {
-	Builder.AppendLine(FString::Printf(TEXT("static int %s_%s_Offset;"), *NativeMethodName, *NativePropertyName));
+	Builder.AppendLinef(TEXT("static int %s_%s_Offset;"), *NativeMethodName, *NativePropertyName);
 }
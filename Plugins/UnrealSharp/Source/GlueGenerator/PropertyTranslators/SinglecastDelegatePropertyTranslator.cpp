@@ -35,14 +35,14 @@ void FSinglecastDelegatePropertyTranslator::ExportPropertyStaticConstruction(FCS
 	if (DelegateProperty->SignatureFunction->NumParms > 0)
 	{
 		FString DelegateName = GetDelegateName(DelegateProperty);
-		Builder.AppendLine(FString::Printf(TEXT("%s.InitializeUnrealDelegate(%s_NativeProperty);"), *DelegateName, *NativePropertyName));
+		Builder.AppendLinef(TEXT("%s.InitializeUnrealDelegate(%s_NativeProperty);"), *DelegateName, *NativePropertyName);
 	}
 }
 
 void FSinglecastDelegatePropertyTranslator::ExportMarshalToNativeBuffer(FCSScriptBuilder& Builder, const FProperty* Property, const FString& NativePropertyName, const FString& DestinationBuffer, const FString& Offset, const FString& Source) const
 {
 	FString DelegateName = GetDelegateName(CastFieldChecked<FDelegateProperty>(Property));
-	Builder.AppendLine(FString::Printf(TEXT("DelegateMarshaller<%s>.ToNative(IntPtr.Add(%s, %s), 0, %s);"), *DelegateName, *DestinationBuffer, *Offset, *Source, *Source));
+	Builder.AppendLinef(TEXT("DelegateMarshaller<%s>.ToNative(IntPtr.Add(%s, %s), 0, %s);"), *DelegateName, *DestinationBuffer, *Offset, *Source, *Source);
 }
 
 void FSinglecastDelegatePropertyTranslator::ExportCleanupMarshallingBuffer(FCSScriptBuilder& Builder, const FProperty* ParamProperty, const FString& NativeParamName) const
@@ -53,7 +53,7 @@ void FSinglecastDelegatePropertyTranslator::ExportCleanupMarshallingBuffer(FCSSc
 void FSinglecastDelegatePropertyTranslator::ExportMarshalFromNativeBuffer(FCSScriptBuilder& Builder, const FProperty* Property, const FString& NativePropertyName, const FString& AssignmentOrReturn, const FString& SourceBuffer, const FString& Offset, bool bCleanupSourceBuffer, bool reuseRefMarshallers) const
 {
 	FString DelegateName = GetDelegateName(CastFieldChecked<FDelegateProperty>(Property));
-	Builder.AppendLine(FString::Printf(TEXT("%s DelegateMarshaller<%s>.FromNative(IntPtr.Add(%s, %s), IntPtr.Zero, 0);"), *AssignmentOrReturn, *DelegateName, *SourceBuffer, *Offset));
+	Builder.AppendLinef(TEXT("%s DelegateMarshaller<%s>.FromNative(IntPtr.Add(%s, %s), IntPtr.Zero, 0);"), *AssignmentOrReturn, *DelegateName, *SourceBuffer, *Offset);
 }
 
 FString FSinglecastDelegatePropertyTranslator::GetNullReturnCSharpValue(const FProperty* ReturnProperty) const
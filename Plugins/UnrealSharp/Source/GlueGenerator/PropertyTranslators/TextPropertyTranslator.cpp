@@ -15,7 +15,7 @@ FString FTextPropertyTranslator::GetNullReturnCSharpValue(const FProperty* Retur
 
 void FTextPropertyTranslator::ExportCppDefaultParameterAsLocalVariable(FCSScriptBuilder& Builder, const FString& VariableName, const FString& CppDefaultValue, UFunction* Function, FProperty* ParamProperty) const
 {
-	Builder.AppendLine(FString::Printf(TEXT("Text %s = Text.None;"), *VariableName));
+	Builder.AppendLinef(TEXT("Text %s = Text.None;"), *VariableName);
 }
 
 FString FTextPropertyTranslator::GetMarshaller(const FProperty* Property) const
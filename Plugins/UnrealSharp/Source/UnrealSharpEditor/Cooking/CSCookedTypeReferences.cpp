@@ -0,0 +1,241 @@
+﻿#include "CSCookedTypeReferences.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "CSharpForUE/CSManager.h"
+#include "Dom/JsonObject.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/GarbageCollection.h"
+#include "UObject/UObjectHash.h"
+#include "UnrealSharpEditor.h"
+#include "UnrealSharpProcHelper/CSProcHelper.h"
+
+namespace CSCookedTypeReferences
+{
+	// Types each package needs, including the ones its dependencies import. Read by FCSTypeRegistry.
+	const TCHAR* PackagesField = TEXT("Packages");
+	
+	// Types each package imports itself, kept for the next iterative cook.
+	const TCHAR* DirectReferencesField = TEXT("DirectReferences");
+
+	void ReadTypeMap(const FJsonObject& Root, const TCHAR* FieldName, TMap<FName, TSet<FName>>& OutTypes)
+	{
+		const TSharedPtr<FJsonObject>* Object;
+		if (!Root.TryGetObjectField(FieldName, Object))
+		{
+			return;
+		}
+		
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*Object)->Values)
+		{
+			TSet<FName>& Types = OutTypes.FindOrAdd(*Pair.Key);
+			for (const TSharedPtr<FJsonValue>& Type : Pair.Value->AsArray())
+			{
+				Types.Add(*Type->AsString());
+			}
+		}
+	}
+
+	TSharedRef<FJsonObject> WriteTypeMap(const TMap<FName, TSet<FName>>& Types)
+	{
+		TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+		
+		for (const TPair<FName, TSet<FName>>& Pair : Types)
+		{
+			TArray<TSharedPtr<FJsonValue>> Values;
+			Values.Reserve(Pair.Value.Num());
+			
+			for (const FName& Type : Pair.Value)
+			{
+				Values.Add(MakeShared<FJsonValueString>(Type.ToString()));
+			}
+			
+			Object->SetArrayField(Pair.Key.ToString(), Values);
+		}
+
+		return Object;
+	}
+}
+
+FCSCookedTypeReferences& FCSCookedTypeReferences::Get()
+{
+	static FCSCookedTypeReferences Instance;
+	return Instance;
+}
+
+void FCSCookedTypeReferences::Initialize()
+{
+	UPackage::PackageSavedWithContextEvent.AddRaw(this, &FCSCookedTypeReferences::OnPackageSaved);
+
+	// Cooking ends by exiting the commandlet, so that's when every package has been saved.
+	FCoreDelegates::OnEnginePreExit.AddRaw(this, &FCSCookedTypeReferences::Save);
+}
+
+void FCSCookedTypeReferences::OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext)
+{
+	if (!SaveContext.IsCooking())
+	{
+		return;
+	}
+
+	TSet<FName>& Types = DirectReferences.FindOrAdd(Package->GetFName());
+	Types.Reset();
+
+	const UPackage* UnrealSharpPackage = FCSManager::GetUnrealSharpPackage();
+	
+	TArray<FName> Dependencies;
+	IAssetRegistry::GetChecked().GetDependencies(Package->GetFName(), Dependencies, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
+
+	// Only packages that import from the UnrealSharp package are worth walking.
+	if (!Dependencies.Contains(UnrealSharpPackage->GetFName()))
+	{
+		return;
+	}
+
+	TArray<UObject*> References;
+	FReferenceFinder ReferenceFinder(References, nullptr, false, false, false, true);
+	
+	ForEachObjectWithPackage(Package, [&References, &ReferenceFinder](UObject* Object)
+	{
+		References.Add(Object->GetClass());
+		ReferenceFinder.FindReferences(Object);
+		return true;
+	});
+
+	for (UObject* Reference : References)
+	{
+		if (!Reference || Reference->GetOutermost() != UnrealSharpPackage)
+		{
+			continue;
+		}
+
+		// Functions, properties and defaults are imported through the type they belong to.
+		UObject* Type = Reference;
+		while (Type->GetOuter() != UnrealSharpPackage)
+		{
+			Type = Type->GetOuter();
+		}
+
+		if (Type->HasAnyFlags(RF_ClassDefaultObject))
+		{
+			Type = Type->GetClass();
+		}
+
+		Types.Add(Type->GetFName());
+	}
+}
+
+void FCSCookedTypeReferences::Save()
+{
+	if (DirectReferences.IsEmpty())
+	{
+		return;
+	}
+
+	TMap<FName, TSet<FName>> AllDirectReferences;
+	TSet<FName> PackagesToResolve;
+	LoadPreviousReferences(AllDirectReferences, PackagesToResolve);
+
+	for (const TPair<FName, TSet<FName>>& Pair : DirectReferences)
+	{
+		PackagesToResolve.Add(Pair.Key);
+		
+		if (Pair.Value.IsEmpty())
+		{
+			AllDirectReferences.Remove(Pair.Key);
+		}
+		else
+		{
+			AllDirectReferences.Add(Pair.Key, Pair.Value);
+		}
+	}
+
+	// Dependencies are loaded along with a package without a load callback of their own,
+	// so every package lists the types of its whole hard dependency tree.
+	IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+	TMap<FName, TSet<FName>> PackageTypes;
+	TArray<FName> PackagesToVisit;
+	TArray<FName> Dependencies;
+	TSet<FName> VisitedPackages;
+	
+	for (const FName& Package : PackagesToResolve)
+	{
+		TSet<FName> Types;
+		VisitedPackages.Reset();
+		PackagesToVisit.Add(Package);
+
+		while (!PackagesToVisit.IsEmpty())
+		{
+			const FName VisitedPackage = PackagesToVisit.Pop(EAllowShrinking::No);
+
+			bool bAlreadyVisited;
+			VisitedPackages.Add(VisitedPackage, &bAlreadyVisited);
+
+			if (bAlreadyVisited)
+			{
+				continue;
+			}
+
+			if (const TSet<FName>* PackageReferences = AllDirectReferences.Find(VisitedPackage))
+			{
+				Types.Append(*PackageReferences);
+			}
+
+			Dependencies.Reset();
+			AssetRegistry.GetDependencies(VisitedPackage, Dependencies, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
+
+			for (const FName& Dependency : Dependencies)
+			{
+				if (!FPackageName::IsScriptPackage(Dependency.ToString()))
+				{
+					PackagesToVisit.Add(Dependency);
+				}
+			}
+		}
+
+		if (!Types.IsEmpty())
+		{
+			PackageTypes.Add(Package, MoveTemp(Types));
+		}
+	}
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetObjectField(CSCookedTypeReferences::PackagesField, CSCookedTypeReferences::WriteTypeMap(PackageTypes));
+	Root->SetObjectField(CSCookedTypeReferences::DirectReferencesField, CSCookedTypeReferences::WriteTypeMap(AllDirectReferences));
+
+	FString Json;
+	FJsonSerializer::Serialize(Root, TJsonWriterFactory<>::Create(&Json));
+
+	const FString FilePath = FCSProcHelper::GetCookedTypeReferencesPath();
+	if (!FFileHelper::SaveStringToFile(Json, *FilePath))
+	{
+		UE_LOG(LogUnrealSharpEditor, Error, TEXT("Could not write the C# types referenced by cooked packages to %s"), *FilePath);
+		return;
+	}
+	
+	UE_LOG(LogUnrealSharpEditor, Display, TEXT("Wrote the C# types referenced by %d cooked packages to %s"), PackageTypes.Num(), *FilePath);
+}
+
+void FCSCookedTypeReferences::LoadPreviousReferences(TMap<FName, TSet<FName>>& OutDirectReferences, TSet<FName>& OutPackages) const
+{
+	FString Json;
+	if (!FFileHelper::LoadFileToString(Json, *FCSProcHelper::GetCookedTypeReferencesPath()))
+	{
+		return;
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Root) || !Root.IsValid())
+	{
+		return;
+	}
+
+	CSCookedTypeReferences::ReadTypeMap(*Root, CSCookedTypeReferences::DirectReferencesField, OutDirectReferences);
+
+	TMap<FName, TSet<FName>> PreviousPackages;
+	CSCookedTypeReferences::ReadTypeMap(*Root, CSCookedTypeReferences::PackagesField, PreviousPackages);
+	PreviousPackages.GetKeys(OutPackages);
+}
@@ -0,0 +1,26 @@
+﻿#pragma once
+
+#include "UObject/ObjectSaveContext.h"
+
+// Records which C# types every cooked package needs, itself or through its dependencies, and writes them next to the user's assembly.
+// Cooked asset registries don't keep package dependencies, so this is how lazy type construction knows what to build for a package.
+class FCSCookedTypeReferences final
+{
+public:
+
+	static FCSCookedTypeReferences& Get();
+
+	void Initialize();
+
+private:
+
+	void OnPackageSaved(const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext SaveContext);
+	void Save();
+
+	// Iterative cooks only save the packages that changed, so the rest is taken from the previous list.
+	void LoadPreviousReferences(TMap<FName, TSet<FName>>& OutDirectReferences, TSet<FName>& OutPackages) const;
+
+	// The C# types each package saved by this cook imports itself. Packages without any have an empty set.
+	TMap<FName, TSet<FName>> DirectReferences;
+	
+};
@@ -28,6 +28,8 @@ public class UnrealSharpEditor : ModuleRules
                 "ToolMenus",
                 "EditorFramework",
                 "InputCore",
+                "AssetRegistry",
+                "Json",
 			}
         );
     }
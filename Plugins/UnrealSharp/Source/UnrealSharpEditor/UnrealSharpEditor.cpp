@@ -1,17 +1,22 @@
 ﻿#include "UnrealSharpEditor.h"
 #include "Widgets/Notifications/SNotificationList.h"
 #include "Framework/Notifications/NotificationManager.h"
+#include "Framework/Docking/TabManager.h"
 #include "DirectoryWatcherModule.h"
 #include "IDirectoryWatcher.h"
 #include "CSharpForUE/CSManager.h"
 #include "CSharpForUE/CSDeveloperSettings.h"
 #include "Misc/ScopedSlowTask.h"
+#include "Misc/MonitoredProcess.h"
 #include "Reinstancing/CSReinstancer.h"
+#include "Cooking/CSCookedTypeReferences.h"
 #include "UnrealSharpProcHelper/CSProcHelper.h"
 
 
 #define LOCTEXT_NAMESPACE "FUnrealSharpEditorModule"
 
+DEFINE_LOG_CATEGORY(LogUnrealSharpEditor);
+
 void FUnrealSharpEditorModule::StartupModule()
 {
 	UToolMenus::RegisterStartupCallback(FSimpleMulticastDelegate::FDelegate::CreateRaw(this, &FUnrealSharpEditorModule::RegisterMenus));
@@ -34,6 +39,7 @@ void FUnrealSharpEditorModule::StartupModule()
 		Handle);
 
 	FCSReinstancer::Get().Initialize();
+	FCSCookedTypeReferences::Get().Initialize();
 
 	TickDelegate = FTickerDelegate::CreateRaw(this, &FUnrealSharpEditorModule::Tick);
 	TickDelegateHandle = FTSTicker::GetCoreTicker().AddTicker(TickDelegate);
@@ -41,6 +47,7 @@ void FUnrealSharpEditorModule::StartupModule()
 
 void FUnrealSharpEditorModule::ShutdownModule()
 {
+	CancelHotReload();
 	FTSTicker::GetCoreTicker().RemoveTicker(TickDelegateHandle);
 	UToolMenus::UnRegisterStartupCallback(this);
 	UToolMenus::UnregisterOwner(this);
@@ -87,26 +94,93 @@ void FUnrealSharpEditorModule::OnCSharpCodeModified(const TArray<FFileChangeData
 
 void FUnrealSharpEditorModule::StartHotReload()
 {
-	FScopedSlowTask Progress(4, LOCTEXT("ReloadingCSharp", "Building C# code..."));
-	Progress.MakeDialog();
+	// A build that's still running is for outdated code, start over with the latest.
+	CancelHotReload();
+
+	FNotificationInfo Info(LOCTEXT("BuildingCSharp", "Building C# code..."));
+	Info.bFireAndForget = false;
+	Info.ExpireDuration = 2.0f;
+	BuildNotification = FSlateNotificationManager::Get().AddNotification(Info);
+	
+	if (BuildNotification.IsValid())
+	{
+		BuildNotification->SetCompletionState(SNotificationItem::CS_Pending);
+	}
+
+	StartBuildStep(Build);
+}
+
+void FUnrealSharpEditorModule::StartBuildStep(EBuildAction BuildAction)
+{
+	TSharedRef<FBuildStep, ESPMode::ThreadSafe> BuildStep = MakeShared<FBuildStep, ESPMode::ThreadSafe>(BuildAction);
+	CurrentBuildStep = BuildStep;
+
+	// Only hold the step weakly. Once the reload is cancelled or the module is shut down, a late completion has nothing to write to.
+	TWeakPtr<FBuildStep, ESPMode::ThreadSafe> WeakBuildStep = BuildStep;
+	
+	BuildProcess = FCSProcHelper::InvokeUnrealSharpBuildToolAsync(BuildAction, [WeakBuildStep](bool bSuccess)
+	{
+		if (const TSharedPtr<FBuildStep, ESPMode::ThreadSafe> PinnedBuildStep = WeakBuildStep.Pin())
+		{
+			PinnedBuildStep->Result = bSuccess ? EBuildStepResult::Succeeded : EBuildStepResult::Failed;
+		}
+	});
 
-	// Build the user's project.
-	if (!FCSProcHelper::InvokeUnrealSharpBuildTool(Build))
+	if (!BuildProcess.IsValid())
+	{
+		CurrentBuildStep.Reset();
+		CloseBuildNotification(false);
+	}
+}
+
+void FUnrealSharpEditorModule::UpdateBuildStep()
+{
+	if (!CurrentBuildStep.IsValid())
 	{
 		return;
 	}
 
-	// Weave the user's project.
-	Progress.EnterProgressFrame(1, LOCTEXT("WeavingCSharp", "Weaving C# code..."));
-	if (!FCSProcHelper::InvokeUnrealSharpBuildTool(Weave))
+	const EBuildStepResult Result = CurrentBuildStep->Result;
+	if (Result == EBuildStepResult::Running)
 	{
 		return;
 	}
+
+	const EBuildAction FinishedAction = CurrentBuildStep->Action;
+	CurrentBuildStep.Reset();
+	BuildProcess.Reset();
+		
+	if (Result == EBuildStepResult::Failed)
+	{
+		CloseBuildNotification(false);
+		return;
+	}
+
+	if (FinishedAction == Build)
+	{
+		if (BuildNotification.IsValid())
+		{
+			BuildNotification->SetText(LOCTEXT("WeavingCSharp", "Weaving C# code..."));
+		}
+		
+		StartBuildStep(Weave);
+	}
+	else
+	{
+		FinishHotReload();
+	}
+}
+
+void FUnrealSharpEditorModule::FinishHotReload()
+{
+	FScopedSlowTask Progress(3, LOCTEXT("ReloadingCSharp", "Reloading C# code..."));
+	Progress.MakeDialog();
 	
 	// Unload the user's assembly, to apply the new one.
 	Progress.EnterProgressFrame(1, LOCTEXT("UnloadingAssembly", "Unloading Assembly..."));
 	if (!FCSManager::Get().UnloadAssembly(FCSProcHelper::GetUserManagedProjectName()))
 	{
+		CloseBuildNotification(false);
 		return;
 	}
 
@@ -114,16 +188,61 @@ void FUnrealSharpEditorModule::StartHotReload()
 	Progress.EnterProgressFrame(1, LOCTEXT("LoadingAssembly", "Loading Assembly..."));
 	if (!FCSManager::Get().LoadUserAssembly())
 	{
+		CloseBuildNotification(false);
 		return;
 	}
 
 	// Reinstance all blueprints.
 	Progress.EnterProgressFrame(1, LOCTEXT("ReinstancingBlueprints", "Reinstancing Blueprints..."));
 	FCSReinstancer::Get().StartReinstancing();
+	
+	CloseBuildNotification(true);
+}
+
+void FUnrealSharpEditorModule::CancelHotReload()
+{
+	CurrentBuildStep.Reset();
+
+	if (BuildProcess.IsValid())
+	{
+		BuildProcess->Cancel(true);
+		BuildProcess.Reset();
+	}
+
+	if (BuildNotification.IsValid())
+	{
+		BuildNotification->SetCompletionState(SNotificationItem::CS_None);
+		BuildNotification->ExpireAndFadeout();
+		BuildNotification.Reset();
+	}
+}
+
+void FUnrealSharpEditorModule::CloseBuildNotification(bool bSuccess)
+{
+	if (!BuildNotification.IsValid())
+	{
+		return;
+	}
+
+	BuildNotification->SetText(bSuccess ? LOCTEXT("ReloadedCSharp", "C# code reloaded") : LOCTEXT("ReloadFailed", "Failed to reload C# code"));
+	BuildNotification->SetCompletionState(bSuccess ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail);
+
+	// The build errors are in the log, point there instead of opening a dialog that blocks the editor.
+	if (!bSuccess)
+	{
+		BuildNotification->SetHyperlink(FSimpleDelegate::CreateLambda([]()
+		{
+			FGlobalTabmanager::Get()->TryInvokeTab(FName(TEXT("OutputLog")));
+		}), LOCTEXT("ShowOutputLog", "Show Output Log"));
+	}
+
+	BuildNotification->ExpireAndFadeout();
+	BuildNotification.Reset();
 }
 
 bool FUnrealSharpEditorModule::Tick(float DeltaTime)
 {
+	UpdateBuildStep();
 
 	const UCSDeveloperSettings* Settings = GetDefault<UCSDeveloperSettings>();
 	if (!Settings->bRequireFocusForHotReload || !bIsReloading || !FApp::HasFocus())
@@ -3,6 +3,13 @@
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
 #include "Containers/Ticker.h"
+#include "UnrealSharpProcHelper/CSProcHelper.h"
+#include <atomic>
+
+class FMonitoredProcess;
+class SNotificationItem;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogUnrealSharpEditor, Log, All);
 
 class FUnrealSharpEditorModule : public IModuleInterface
 {
@@ -19,12 +26,42 @@ public:
     bool IsReloading() const { return bIsReloading; }
 
 private:
+
+    enum class EBuildStepResult : uint8
+    {
+        Running,
+        Succeeded,
+        Failed,
+    };
+
+    // Shared with the build process' thread, which only sets the result when the process completes.
+    struct FBuildStep
+    {
+        explicit FBuildStep(EBuildAction InAction) : Action(InAction) {}
+        
+        const EBuildAction Action;
+        std::atomic<EBuildStepResult> Result { EBuildStepResult::Running };
+    };
     
     bool Tick(float DeltaTime);
+
+    // Build and weave run in the background one after the other, only loading the new assembly blocks the editor.
+    // The steps are advanced from Tick, once the process of the current step has completed.
+    void StartBuildStep(EBuildAction BuildAction);
+    void UpdateBuildStep();
+    void FinishHotReload();
+    void CancelHotReload();
+    void CloseBuildNotification(bool bSuccess);
     
     FTickerDelegate TickDelegate;
     FTSTicker::FDelegateHandle TickDelegateHandle;
     bool bIsReloading = false;
 
+    TSharedPtr<FMonitoredProcess> BuildProcess;
+    TSharedPtr<SNotificationItem> BuildNotification;
+
+    // Reset when the reload is cancelled, so a step that completes for an outdated reload has nothing left to update.
+    TSharedPtr<FBuildStep, ESPMode::ThreadSafe> CurrentBuildStep;
+
     void RegisterMenus();
 };
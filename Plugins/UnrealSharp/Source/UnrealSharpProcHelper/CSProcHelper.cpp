@@ -4,6 +4,7 @@
 #include "Misc/Paths.h"
 #include "Interfaces/IPluginManager.h"
 #include "Misc/MessageDialog.h"
+#include "Misc/MonitoredProcess.h"
 
 bool FCSProcHelper::InvokeCommand(const FString& ProgramPath, const FString& Arguments, int32& OutReturnCode, FString& Output, FString* InWorkingDirectory)
 {
@@ -51,7 +52,13 @@ bool FCSProcHelper::InvokeCommand(const FString& ProgramPath, const FString& Arg
 	while (FPlatformProcess::IsProcRunning(ProcHandle))
 	{
 		Output += FPlatformProcess::ReadPipe(ReadPipe);
+		
+		// Don't spin a core while waiting for the process to write more.
+		FPlatformProcess::Sleep(0.01f);
 	}
+
+	// Pick up whatever was written between the last read and the process exiting.
+	Output += FPlatformProcess::ReadPipe(ReadPipe);
 	
 	FPlatformProcess::GetProcReturnCode(ProcHandle, &OutReturnCode);
 	FPlatformProcess::CloseProc(ProcHandle);
@@ -74,6 +81,63 @@ bool FCSProcHelper::InvokeCommand(const FString& ProgramPath, const FString& Arg
 }
 
 bool FCSProcHelper::InvokeUnrealSharpBuildTool(EBuildAction BuildAction, EDotNetBuildConfiguration* BuildConfiguration, const FString* InOutputDirectory)
+{
+	int32 ReturnCode = 0;
+	FString Output;
+	FString WorkingDirectory = GetAssembliesPath();
+	return InvokeCommand(GetDotNetExecutablePath(), GetUnrealSharpBuildToolArguments(BuildAction, BuildConfiguration), ReturnCode, Output, &WorkingDirectory);
+}
+
+TSharedPtr<FMonitoredProcess> FCSProcHelper::InvokeUnrealSharpBuildToolAsync(EBuildAction BuildAction, TFunction<void(bool bSuccess)> OnCompleted)
+{
+	const FString DotNetPath = GetDotNetExecutablePath();
+	const FString Arguments = GetUnrealSharpBuildToolArguments(BuildAction);
+	const FString ActionName = StaticEnum<EBuildAction>()->GetNameStringByValue(BuildAction);
+	
+	if (!FPaths::FileExists(DotNetPath))
+	{
+		UE_LOG(LogUnrealSharpProcHelper, Error, TEXT("Failed to find dotnet at %s"), *DotNetPath);
+		return nullptr;
+	}
+
+	TSharedPtr<FMonitoredProcess> Process = MakeShared<FMonitoredProcess>(DotNetPath, Arguments, GetAssembliesPath(), true);
+
+	// Output and completion are both delivered on the process' own thread, so the output can be collected without locking.
+	TSharedRef<FString> Output = MakeShared<FString>();
+	const double StartTime = FPlatformTime::Seconds();
+	
+	Process->OnOutput().BindLambda([Output](const FString& Line)
+	{
+		UE_LOG(LogUnrealSharpProcHelper, Display, TEXT("%s"), *Line);
+		Output->Append(Line);
+		Output->AppendChar(TEXT('\n'));
+	});
+	
+	// No dialog here, the caller decides how to report a failure and the output is already in the log.
+	Process->OnCompleted().BindLambda([Output, ActionName, StartTime, OnCompleted = MoveTemp(OnCompleted)](int32 ReturnCode)
+	{
+		if (ReturnCode != 0)
+		{
+			UE_LOG(LogUnrealSharpProcHelper, Error, TEXT("%s task failed with return code %d. Error: %s"), *ActionName, ReturnCode, **Output);
+		}
+		else
+		{
+			UE_LOG(LogUnrealSharpProcHelper, Log, TEXT("%s task took %f seconds to execute."), *ActionName, FPlatformTime::Seconds() - StartTime);
+		}
+		
+		OnCompleted(ReturnCode == 0);
+	});
+
+	if (!Process->Launch())
+	{
+		UE_LOG(LogUnrealSharpProcHelper, Error, TEXT("%s task failed to launch!"), *ActionName);
+		return nullptr;
+	}
+
+	return Process;
+}
+
+FString FCSProcHelper::GetUnrealSharpBuildToolArguments(EBuildAction BuildAction, EDotNetBuildConfiguration* BuildConfiguration)
 {
 	FName BuildActionCommand = StaticEnum<EBuildAction>()->GetNameByValue(BuildAction);
 	FString PluginFolder = FPaths::ConvertRelativePathToFull(IPluginManager::Get().FindPlugin(UE_PLUGIN_NAME)->GetBaseDir());
@@ -93,11 +157,8 @@ bool FCSProcHelper::InvokeUnrealSharpBuildTool(EBuildAction BuildAction, EDotNet
 		FText BuildConfigurationString = StaticEnum<EDotNetBuildConfiguration>()->GetDisplayNameTextByValue(static_cast<int64>(*BuildConfiguration));
 		Args += FString::Printf(TEXT(" --BuildConfig %s"), *BuildConfigurationString.ToString());
 	}
-	
-	int32 ReturnCode = 0;
-	FString Output;
-	FString WorkingDirectory = GetAssembliesPath();
-	return InvokeCommand(DotNetPath, Args, ReturnCode, Output, &WorkingDirectory);
+
+	return Args;
 }
 
 bool FCSProcHelper::Clean()
@@ -180,6 +241,11 @@ FString FCSProcHelper::GetUserAssemblyPath()
 	return FPaths::Combine(GetUserAssemblyDirectory(), GetUserManagedProjectName() + ".dll");
 }
 
+FString FCSProcHelper::GetCookedTypeReferencesPath()
+{
+	return FPaths::Combine(GetUserAssemblyDirectory(), "CookedTypeReferences.json");
+}
+
 FString FCSProcHelper::GetUnrealSharpBuildToolPath()
 {
 	return FPaths::ConvertRelativePathToFull(GetAssembliesPath() / "UnrealSharpBuildTool.dll");
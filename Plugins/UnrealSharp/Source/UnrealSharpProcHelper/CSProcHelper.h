@@ -23,12 +23,18 @@ enum class EDotNetBuildConfiguration : uint64
 #define HOSTFXR_LINUX "libhostfxr.so"
 #define DOTNET_MAJOR_VERSION "8.0.0"
 
+class FMonitoredProcess;
+
 class UNREALSHARPPROCHELPER_API FCSProcHelper final
 {
 public:
 	
 	static bool InvokeCommand(const FString& ProgramPath, const FString& Arguments, int32& OutReturnCode, FString& Output, FString* InWorkingDirectory = nullptr);
 	static bool InvokeUnrealSharpBuildTool(EBuildAction BuildAction, EDotNetBuildConfiguration* BuildConfiguration = nullptr, const FString* OutputDirectory = nullptr);
+
+	// Starts the build tool on a background thread and returns right away. Output is streamed to the log as it arrives.
+	// OnCompleted is called on the process' own thread, unless the returned process is cancelled first.
+	static TSharedPtr<FMonitoredProcess> InvokeUnrealSharpBuildToolAsync(EBuildAction BuildAction, TFunction<void(bool bSuccess)> OnCompleted);
 	
 	static bool Clean();
 	static bool GenerateProject();
@@ -47,6 +53,9 @@ public:
 	// Path to the user's assembly.
 	static FString GetUserAssemblyPath();
 
+	// Path to the list of C# types each cooked package needs, written when cooking and shipped next to the user's assembly.
+	static FString GetCookedTypeReferencesPath();
+
 	// Path to the .NET runtime root. Only really works in editor, since players don't have the .NET runtime.
 	static FString GetDotNetDirectory();
 
@@ -73,5 +82,9 @@ public:
 
 	// Path to the runtime host. This is different in editor/builds.
 	static FString GetRuntimeHostPath();
+
+private:
+
+	static FString GetUnrealSharpBuildToolArguments(EBuildAction BuildAction, EDotNetBuildConfiguration* BuildConfiguration = nullptr);
 	
 };